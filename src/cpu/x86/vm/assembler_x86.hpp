@@ -1026,6 +1026,9 @@ private:
   // Identify processor type and features
   void cpuid();
 
+  // Accumulate CRC32C (Castagnoli) of 1, 4 or (64-bit only) 8 bytes
+  void crc32(Register crc, Address adr, int8_t sizeInBytes);
+
   // Convert Scalar Double-Precision Floating-Point Value to Scalar Single-Precision Floating-Point Value
   void cvtsd2ss(XMMRegister dst, XMMRegister src);
   void cvtsd2ss(XMMRegister dst, Address src);
@@ -1687,6 +1690,8 @@ private:
   // Get Value of Extended Control Register
   void xgetbv();
 
+  void xorb(Register dst, Address src);
+
   void xorl(Register dst, int32_t imm32);
   void xorl(Register dst, Address src);
   void xorl(Register dst, Register src);
@@ -1715,6 +1720,12 @@ private:
   void vsubss(XMMRegister dst, XMMRegister nds, Address src);
   void vsubss(XMMRegister dst, XMMRegister nds, XMMRegister src);
 
+  // Fused multiply-add, dst = src1 * src2 + dst (FMA3, encoded with VEX prefix)
+  void vfmadd231sd(XMMRegister dst, XMMRegister src1, XMMRegister src2);
+  void vfmadd231ss(XMMRegister dst, XMMRegister src1, XMMRegister src2);
+  void vfmadd231pd(XMMRegister dst, XMMRegister src1, XMMRegister src2, bool vector256);
+  void vfmadd231ps(XMMRegister dst, XMMRegister src1, XMMRegister src2, bool vector256);
+
 
   //====================VECTOR ARITHMETIC=====================================
 
@@ -1797,6 +1808,13 @@ private:
   // Multiply packed integers (only shorts and ints)
   void pmullw(XMMRegister dst, XMMRegister src);
   void pmulld(XMMRegister dst, XMMRegister src);
+
+  // Multiply and add adjacent packed integers
+  void pmaddubsw(XMMRegister dst, XMMRegister src);
+  void pmaddwd(XMMRegister dst, XMMRegister src);
+
+  // Sum of absolute differences of packed unsigned bytes
+  void psadbw(XMMRegister dst, XMMRegister src);
   void vpmullw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
   void vpmulld(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
   void vpmullw(XMMRegister dst, XMMRegister nds, Address src, bool vector256);
@@ -1840,6 +1858,10 @@ private:
   void vpsraw(XMMRegister dst, XMMRegister src, XMMRegister shift, bool vector256);
   void vpsrad(XMMRegister dst, XMMRegister src, XMMRegister shift, bool vector256);
 
+  // Minimum/maximum of packed signed integers (only ints)
+  void pminsd(XMMRegister dst, XMMRegister src);
+  void pmaxsd(XMMRegister dst, XMMRegister src);
+
   // And packed integers
   void pand(XMMRegister dst, XMMRegister src);
   void vpand(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
@@ -1865,6 +1887,10 @@ private:
   void vextractf128h(Address dst, XMMRegister src);
   void vextracti128h(Address dst, XMMRegister src);
 
+  // Copy high 128bit of YMM registers into low 128bit of XMM registers.
+  void vextractf128h(XMMRegister dst, XMMRegister src);
+  void vextracti128h(XMMRegister dst, XMMRegister src);
+
   // duplicate 4-bytes integer data from src into 8 locations in dest
   void vpbroadcastd(XMMRegister dst, XMMRegister src);
 
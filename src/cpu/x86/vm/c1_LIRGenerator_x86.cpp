@@ -1011,6 +1011,154 @@ void LIRGenerator::do_update_CRC32(Intrinsic* x) {
   }
 }
 
+// CRC32C and Adler32 of a byte[] range or of off-heap memory. The CRC32C
+// methods pass the end index rather than the length.
+void LIRGenerator::do_update_checksum(Intrinsic* x) {
+  bool is_crc32c = (x->id() == vmIntrinsics::_updateBytesCRC32C ||
+                    x->id() == vmIntrinsics::_updateDirectByteBufferCRC32C);
+  bool is_updateBytes = (x->id() == vmIntrinsics::_updateBytesCRC32C ||
+                         x->id() == vmIntrinsics::_updateBytesAdler32);
+  assert(!is_crc32c || UseCRC32CIntrinsics, "need SSE4.2 instructions support");
+  assert(is_crc32c || UseAdler32Intrinsics, "need SSSE3 instructions support");
+  address stub = is_crc32c ? StubRoutines::updateBytesCRC32C() : StubRoutines::updateBytesAdler32();
+
+  LIR_Opr result = rlock_result(x);
+
+  LIRItem crc(x->argument_at(0), this);
+  LIRItem buf(x->argument_at(1), this);
+  LIRItem off(x->argument_at(2), this);
+  LIRItem len(x->argument_at(3), this);
+  buf.load_item();
+  off.load_nonconstant();
+
+  LIR_Opr index = off.result();
+  int offset = is_updateBytes ? arrayOopDesc::base_offset_in_bytes(T_BYTE) : 0;
+  if (off.result()->is_constant()) {
+    index = LIR_OprFact::illegalOpr;
+    offset += off.result()->as_jint();
+  }
+  LIR_Opr base_op = buf.result();
+
+#ifndef _LP64
+  if (!is_updateBytes) { // long b raw address
+    base_op = new_register(T_INT);
+    __ convert(Bytecodes::_l2i, buf.result(), base_op);
+  }
+#else
+  if (index->is_valid()) {
+    LIR_Opr tmp = new_register(T_LONG);
+    __ convert(Bytecodes::_i2l, index, tmp);
+    index = tmp;
+  }
+#endif
+
+  LIR_Address* a = new LIR_Address(base_op,
+                                   index,
+                                   LIR_Address::times_1,
+                                   offset,
+                                   T_BYTE);
+  BasicTypeList signature(3);
+  signature.append(T_INT);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIR_Opr addr = new_pointer_register();
+  __ leal(LIR_OprFact::address(a), addr);
+
+  crc.load_item_force(cc->at(0));
+  __ move(addr, cc->at(1));
+  if (is_crc32c) {
+    len.load_item();
+    LIR_Opr length = new_register(T_INT);
+    __ sub(len.result(), off.result(), length);
+    __ move(length, cc->at(2));
+  } else {
+    len.load_item_force(cc->at(2));
+  }
+
+  __ call_runtime_leaf(stub, getThreadTemp(), result_reg, cc->args());
+  __ move(result_reg, result);
+}
+
+void LIRGenerator::do_vectorizedMismatch(Intrinsic* x) {
+  assert(UseVectorizedMismatchIntrinsic, "need SSE4.1 instructions support");
+  // Make all state_for calls early since they can emit code
+  LIR_Opr result = rlock_result(x);
+
+  LIRItem a(x->argument_at(0), this);        // Object
+  LIRItem a_offset(x->argument_at(1), this); // long
+  LIRItem b(x->argument_at(2), this);        // Object
+  LIRItem b_offset(x->argument_at(3), this); // long
+  LIRItem length(x->argument_at(4), this);   // int
+  LIRItem scale(x->argument_at(5), this);    // int
+
+  // Either an array with an offset, or null with an absolute address.
+  a.load_item();
+  a_offset.load_nonconstant();
+  b.load_item();
+  b_offset.load_nonconstant();
+
+  LIR_Opr base_a = a.result();
+  LIR_Opr index_a = a_offset.result();
+  jlong disp_a = 0;
+  if (index_a->is_constant() && index_a->as_jlong() == (jlong)(jint)index_a->as_jlong()) {
+    disp_a = index_a->as_jlong();
+    index_a = LIR_OprFact::illegalOpr;
+  } else {
+    a_offset.load_item();
+    index_a = a_offset.result();
+  }
+  LIR_Opr base_b = b.result();
+  LIR_Opr index_b = b_offset.result();
+  jlong disp_b = 0;
+  if (index_b->is_constant() && index_b->as_jlong() == (jlong)(jint)index_b->as_jlong()) {
+    disp_b = index_b->as_jlong();
+    index_b = LIR_OprFact::illegalOpr;
+  } else {
+    b_offset.load_item();
+    index_b = b_offset.result();
+  }
+
+#ifndef _LP64
+  if (index_a->is_valid()) {
+    LIR_Opr tmp = new_register(T_INT);
+    __ convert(Bytecodes::_l2i, index_a, tmp);
+    index_a = tmp;
+  }
+  if (index_b->is_valid()) {
+    LIR_Opr tmp = new_register(T_INT);
+    __ convert(Bytecodes::_l2i, index_b, tmp);
+    index_b = tmp;
+  }
+#endif
+
+  LIR_Address* addr_a = new LIR_Address(base_a, index_a, LIR_Address::times_1, (intx)disp_a, T_BYTE);
+  LIR_Address* addr_b = new LIR_Address(base_b, index_b, LIR_Address::times_1, (intx)disp_b, T_BYTE);
+
+  BasicTypeList signature(4);
+  signature.append(T_ADDRESS);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIR_Opr ptr_a = new_pointer_register();
+  __ leal(LIR_OprFact::address(addr_a), ptr_a);
+  LIR_Opr ptr_b = new_pointer_register();
+  __ leal(LIR_OprFact::address(addr_b), ptr_b);
+
+  __ move(ptr_a, cc->at(0));
+  __ move(ptr_b, cc->at(1));
+  length.load_item_force(cc->at(2));
+  scale.load_item_force(cc->at(3));
+
+  __ call_runtime_leaf(StubRoutines::vectorizedMismatch(), getThreadTemp(), result_reg, cc->args());
+  __ move(result_reg, result);
+}
+
 // _i2l, _i2f, _i2d, _l2i, _l2f, _l2d, _f2i, _f2l, _f2d, _d2i, _d2l, _d2f
 // _i2b, _i2c, _i2s
 LIR_Opr fixed_register_for(BasicType type) {
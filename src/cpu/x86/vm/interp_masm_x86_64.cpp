@@ -472,7 +472,8 @@ void InterpreterMacroAssembler::dispatch_epilog(TosState state, int step) {
 
 void InterpreterMacroAssembler::dispatch_base(TosState state,
                                               address* table,
-                                              bool verifyoop) {
+                                              bool verifyoop,
+                                              bool generate_poll) {
   verify_FPU(1, state);
   if (VerifyActivationFrameSize) {
     Label L;
@@ -489,12 +490,24 @@ void InterpreterMacroAssembler::dispatch_base(TosState state,
   if (verifyoop) {
     verify_oop(rax, state);
   }
+  Label dispatch;
+  if (generate_poll && SafepointSynchronize::uses_thread_local_poll()) {
+    Label no_safepoint;
+    NOT_PRODUCT(block_comment("Thread-local safepoint poll"));
+    movptr(rscratch1, Address(r15_thread, JavaThread::polling_page_offset()));
+    testl(rscratch1, SafepointSynchronize::poll_bit());
+    jccb(Assembler::zero, no_safepoint);
+    lea(rscratch1, ExternalAddress((address)Interpreter::safept_table(state)));
+    jmpb(dispatch);
+    bind(no_safepoint);
+  }
   lea(rscratch1, ExternalAddress((address)table));
+  bind(dispatch);
   jmp(Address(rscratch1, rbx, Address::times_8));
 }
 
-void InterpreterMacroAssembler::dispatch_only(TosState state) {
-  dispatch_base(state, Interpreter::dispatch_table(state));
+void InterpreterMacroAssembler::dispatch_only(TosState state, bool generate_poll) {
+  dispatch_base(state, Interpreter::dispatch_table(state), true, generate_poll);
 }
 
 void InterpreterMacroAssembler::dispatch_only_normal(TosState state) {
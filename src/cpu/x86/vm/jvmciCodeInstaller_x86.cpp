@@ -201,6 +201,9 @@ static void relocate_poll_near(address pc) {
 
 
 void CodeInstaller::pd_relocate_poll(address pc, jint mark, JVMCI_TRAPS) {
+  // Near polls read the global polling page. Safepoints still protect it
+  // with thread-local polls, so such code stops at safepoints, and
+  // handshakes reach it through the safepoint fallback.
   switch (mark) {
     case POLL_NEAR: {
       relocate_poll_near(pc);
@@ -209,6 +212,8 @@ void CodeInstaller::pd_relocate_poll(address pc, jint mark, JVMCI_TRAPS) {
     }
     case POLL_FAR:
       // This is a load from a register so there is no relocatable operand.
+      // The register holds the global polling page address or, for
+      // thread-local polls, the polling word from JavaThread::_polling_page.
       // We just have to ensure that the format is not disp32_operand
       // so that poll_Relocation::fix_relocation_after_move does the right
       // thing (i.e. ignores this relocation record)
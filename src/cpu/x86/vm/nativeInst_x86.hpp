@@ -547,6 +547,28 @@ class NativeTstRegMem: public NativeInstruction {
     modrm_mask                  = 0x38, // select reg from the ModRM byte
     modrm_reg                   = 0x00  // rax
   };
+
+  // Length of a "testl rax, [reg]" thread-local poll: optional REX prefix,
+  // opcode and ModRM, plus a SIB byte (rsp/r12 base) or displacement.
+  static int poll_instruction_size_at(address pc) {
+    int size = 0;
+    if ((pc[size] & instruction_rex_prefix_mask) == instruction_rex_prefix) {
+      size++;
+    }
+    assert(pc[size] == instruction_code_memXregl, "must be a test instruction");
+    u_char modrm = pc[size + 1];
+    size += 2;
+    if ((modrm & 0x07) == 0x04) {
+      size++;                   // SIB byte
+    }
+    switch (modrm >> 6) {
+      case 0: if ((modrm & 0x07) == 0x05) size += 4; break; // rip-relative disp32 (near poll)
+      case 1: size += 1; break; // disp8
+      case 2: size += 4; break; // disp32
+      default: break;
+    }
+    return size;
+  }
 };
 
 inline bool NativeInstruction::is_illegal()      { return (short)int_at(0) == (short)NativeIllegalInstruction::instruction_code; }
@@ -576,7 +598,8 @@ inline bool NativeInstruction::is_safepoint_poll() {
        (ubyte_at(2) & NativeTstRegMem::modrm_mask) == NativeTstRegMem::modrm_reg) ||
       ubyte_at(0) == NativeTstRegMem::instruction_code_memXregl &&
       (ubyte_at(1) & NativeTstRegMem::modrm_mask) == NativeTstRegMem::modrm_reg) {
-    NOT_JVMCI(assert(Assembler::is_polling_page_far(), "unexpected poll encoding");)
+    // Thread-local polls (ThreadLocalHandshakes) use the far encoding too.
+    NOT_JVMCI(assert(Assembler::is_polling_page_far() || ThreadLocalHandshakes, "unexpected poll encoding");)
     return true;
   }
   return false;
@@ -182,7 +182,9 @@ void poll_Relocation::fix_relocation_after_move(const CodeBuffer* src, CodeBuffe
   typedef Assembler::WhichOperand WhichOperand;
   WhichOperand which = (WhichOperand) format();
 #if !INCLUDE_JVMCI
-  assert((which == Assembler::disp32_operand) == !Assembler::is_polling_page_far(), "format not set correctly");
+  assert((which == Assembler::disp32_operand) ==
+         !(Assembler::is_polling_page_far() || SafepointSynchronize::uses_thread_local_poll()),
+         "format not set correctly");
 #endif
   if (which == Assembler::disp32_operand) {
     address orig_addr = old_addr_for(addr(), src, dest);
@@ -3640,6 +3640,251 @@ class StubGenerator: public StubCodeGenerator {
   }
 
 
+  // byte swap of a 128-bit word, turns the big-endian CTR counter into a
+  // little-endian one
+  address generate_counter_shuffle_mask() {
+    __ align(16);
+    StubCodeMark mark(this, "StubRoutines", "counter_shuffle_mask");
+    address start = __ pc();
+    __ emit_data64(0x08090a0b0c0d0e0f, relocInfo::none);
+    __ emit_data64(0x0001020304050607, relocInfo::none);
+    return start;
+  }
+
+  // Utility routine for incrementing the little-endian 128-bit counter in xmmdst
+  void inc_counter(Register reg, XMMRegister xmmdst) {
+    Label L_no_carry;
+    __ pextrq(reg, xmmdst, 0x00);
+    __ addq(reg, 1);
+    __ pinsrq(xmmdst, reg, 0x00);
+    __ jccb(Assembler::carryClear, L_no_carry);
+    __ pextrq(reg, xmmdst, 0x01);
+    __ addq(reg, 1);
+    __ pinsrq(xmmdst, reg, 0x01);
+    __ bind(L_no_carry);
+  }
+
+  // Utility routine for the AES rounds 1 .. last on the blocks in
+  // xmm0 .. xmm(nblocks - 1), which already have round key 0 applied.
+  // The number of rounds follows from the length of the key array.
+  void aes_enc_rounds(Register key, int nblocks, XMMRegister xmm_key, XMMRegister xmm_key_shuf_mask) {
+    Label L_last;
+    const Address keylen(key, arrayOopDesc::length_offset_in_bytes() - arrayOopDesc::base_offset_in_bytes(T_INT));
+
+    for (int offset = 0x10; offset <= 0x90; offset += 0x10) {
+      load_key(xmm_key, key, offset, xmm_key_shuf_mask);
+      for (int i = 0; i < nblocks; i++) {
+        __ aesenc(as_XMMRegister(i), xmm_key);
+      }
+    }
+    load_key(xmm_key, key, 0xa0, xmm_key_shuf_mask);
+    __ cmpl(keylen, 44);
+    __ jcc(Assembler::equal, L_last);
+    for (int offset = 0xb0; offset <= 0xc0; offset += 0x10) {
+      for (int i = 0; i < nblocks; i++) {
+        __ aesenc(as_XMMRegister(i), xmm_key);
+      }
+      load_key(xmm_key, key, offset, xmm_key_shuf_mask);
+    }
+    __ cmpl(keylen, 52);
+    __ jcc(Assembler::equal, L_last);
+    for (int offset = 0xd0; offset <= 0xe0; offset += 0x10) {
+      for (int i = 0; i < nblocks; i++) {
+        __ aesenc(as_XMMRegister(i), xmm_key);
+      }
+      load_key(xmm_key, key, offset, xmm_key_shuf_mask);
+    }
+    __ BIND(L_last);
+    for (int i = 0; i < nblocks; i++) {
+      __ aesenclast(as_XMMRegister(i), xmm_key);
+    }
+  }
+
+  // AES counter mode, eight blocks per iteration
+  //
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - source byte array address
+  //   c_rarg1   - destination byte array address
+  //   c_rarg2   - K (key) in little endian int array
+  //   c_rarg3   - counter vector byte array address
+  //   c_rarg4   - input length
+  //   c_rarg5   - saved encryptedCounter start
+  //   rbp + 16  - saved used length address (on stack)
+  //
+  // Output:
+  //   rax       - input length
+  //
+  // Matches CounterMode.implCrypt: the bytes left in the saved encrypted
+  // counter are used first, then whole blocks, and the encryption of the
+  // counter for a trailing partial block is saved for the next call.
+  //
+  address generate_counterMode_AESCrypt_Parallel() {
+    assert(UseAES, "need AES instructions and misaligned SSE support");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "counterMode_AESCrypt");
+    address start = __ pc();
+
+    const Register from    = c_rarg0;  // source array address
+    const Register to      = c_rarg1;  // destination array address
+    const Register key     = c_rarg2;  // key array address
+    const Register counter = c_rarg3;  // counter byte array initialized from counter array address
+                                       // and updated with the incremented counter in the end
+#ifndef _WIN64
+    const Register len_reg = c_rarg4;
+    const Register saved_encCounter_start = c_rarg5;
+    const Address  used_addr_mem(rbp, 2 * wordSize);
+    const Register used    = r11;
+    const Register tmp     = r10;
+#else
+    const Address  len_mem(rbp, 6 * wordSize);  // length is on stack on Win64
+    const Address  saved_encCounter_mem(rbp, 7 * wordSize);
+    const Address  used_addr_mem(rbp, 8 * wordSize);
+    const Register len_reg = r10;      // pick the first volatile windows register
+    const Register saved_encCounter_start = r11;
+    const Register used    = r12;      // callee saved, pushed below
+    const Register tmp     = r13;
+#endif
+    const Register pos     = rax;
+
+    const int PARALLEL_FACTOR = 8;
+#ifdef _WIN64
+    const int XMM_REG_NUM_SAVE_LAST = 12;
+#endif
+
+    // xmm0 .. xmm7 hold the blocks being encrypted
+    const XMMRegister xmm_counter       = xmm8;
+    const XMMRegister xmm_counter_shuf  = xmm9;
+    const XMMRegister xmm_key_shuf_mask = xmm10;
+    const XMMRegister xmm_key           = xmm11;
+    const XMMRegister xmm_from          = xmm12;
+    const XMMRegister xmm_result        = xmm0;
+
+    Label L_preLoop, L_preLoop_done, L_multiBlock_loopTop, L_singleBlock_loopTop;
+    Label L_tail, L_tail_loop, L_exit;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+#ifdef _WIN64
+    // save the xmm registers which must be preserved 6-12
+    __ subptr(rsp, -rsp_after_call_off * wordSize);
+    for (int i = 6; i <= XMM_REG_NUM_SAVE_LAST; i++) {
+      __ movdqu(xmm_save(i), as_XMMRegister(i));
+    }
+    __ push(r12);
+    __ push(r13);
+    // on win64, fill len_reg and saved_encCounter_start from stack position
+    __ movl(len_reg, len_mem);
+    __ movptr(saved_encCounter_start, saved_encCounter_mem);
+#endif
+    __ push(len_reg); // Save
+
+    __ movptr(tmp, used_addr_mem);
+    __ movl(used, Address(tmp, 0));
+    __ movdqu(xmm_key_shuf_mask, ExternalAddress(StubRoutines::x86::key_shuffle_mask_addr()));
+    __ movdqu(xmm_counter_shuf, ExternalAddress(StubRoutines::x86::counter_shuffle_mask_addr()));
+    __ movdqu(xmm_counter, Address(counter, 0));
+    __ pshufb(xmm_counter, xmm_counter_shuf);   // counter in little endian
+    __ xorptr(pos, pos);
+
+    // Use up the bytes left from the last encrypted counter
+    __ BIND(L_preLoop);
+    __ cmpl(used, AESBlockSize);
+    __ jcc(Assembler::aboveEqual, L_preLoop_done);
+    __ testptr(len_reg, len_reg);
+    __ jcc(Assembler::zero, L_exit);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ addptr(pos, 1);
+    __ addl(used, 1);
+    __ subptr(len_reg, 1);
+    __ jmp(L_preLoop);
+
+    __ BIND(L_preLoop_done);
+
+    __ align(OptoLoopAlignment);
+    __ BIND(L_multiBlock_loopTop);
+    __ cmpptr(len_reg, PARALLEL_FACTOR * AESBlockSize);  // see if at least 8 blocks left
+    __ jcc(Assembler::less, L_singleBlock_loopTop);
+
+    load_key(xmm_key, key, 0x00, xmm_key_shuf_mask);
+    for (int i = 0; i < PARALLEL_FACTOR; i++) {
+      XMMRegister xmm_block = as_XMMRegister(i);
+      __ movdqa(xmm_block, xmm_counter);
+      __ pshufb(xmm_block, xmm_counter_shuf);   // back to big endian
+      __ pxor(xmm_block, xmm_key);
+      inc_counter(tmp, xmm_counter);
+    }
+    aes_enc_rounds(key, PARALLEL_FACTOR, xmm_key, xmm_key_shuf_mask);
+    for (int i = 0; i < PARALLEL_FACTOR; i++) {
+      XMMRegister xmm_block = as_XMMRegister(i);
+      __ movdqu(xmm_from, Address(from, pos, Address::times_1, i * AESBlockSize));
+      __ pxor(xmm_block, xmm_from);
+      __ movdqu(Address(to, pos, Address::times_1, i * AESBlockSize), xmm_block);
+    }
+    __ addptr(pos, PARALLEL_FACTOR * AESBlockSize);
+    __ subptr(len_reg, PARALLEL_FACTOR * AESBlockSize);
+    __ jmp(L_multiBlock_loopTop);
+
+    __ BIND(L_singleBlock_loopTop);
+    __ cmpptr(len_reg, AESBlockSize);
+    __ jcc(Assembler::less, L_tail);
+    load_key(xmm_key, key, 0x00, xmm_key_shuf_mask);
+    __ movdqa(xmm_result, xmm_counter);
+    __ pshufb(xmm_result, xmm_counter_shuf);
+    __ pxor(xmm_result, xmm_key);
+    inc_counter(tmp, xmm_counter);
+    aes_enc_rounds(key, 1, xmm_key, xmm_key_shuf_mask);
+    __ movdqu(xmm_from, Address(from, pos, Address::times_1, 0));
+    __ pxor(xmm_result, xmm_from);
+    __ movdqu(Address(to, pos, Address::times_1, 0), xmm_result);
+    __ addptr(pos, AESBlockSize);
+    __ subptr(len_reg, AESBlockSize);
+    __ jmp(L_singleBlock_loopTop);
+
+    // Partial last block: save the encrypted counter for the next call
+    __ BIND(L_tail);
+    __ testptr(len_reg, len_reg);
+    __ jcc(Assembler::zero, L_exit);
+    load_key(xmm_key, key, 0x00, xmm_key_shuf_mask);
+    __ movdqa(xmm_result, xmm_counter);
+    __ pshufb(xmm_result, xmm_counter_shuf);
+    __ pxor(xmm_result, xmm_key);
+    inc_counter(tmp, xmm_counter);
+    aes_enc_rounds(key, 1, xmm_key, xmm_key_shuf_mask);
+    __ movdqu(Address(saved_encCounter_start, 0), xmm_result);
+    __ xorl(used, used);
+    __ BIND(L_tail_loop);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ addptr(pos, 1);
+    __ addl(used, 1);
+    __ subptr(len_reg, 1);
+    __ jcc(Assembler::notZero, L_tail_loop);
+
+    __ BIND(L_exit);
+    __ pshufb(xmm_counter, xmm_counter_shuf);   // counter back to big endian
+    __ movdqu(Address(counter, 0), xmm_counter);
+    __ movptr(tmp, used_addr_mem);
+    __ movl(Address(tmp, 0), used);
+    __ pop(rax); // return length
+#ifdef _WIN64
+    __ pop(r13);
+    __ pop(r12);
+    // restore regs belonging to calling function
+    for (int i = 6; i <= XMM_REG_NUM_SAVE_LAST; i++) {
+      __ movdqu(as_XMMRegister(i), xmm_save(i));
+    }
+#endif
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   // byte swap x86 long
   address generate_ghash_long_swap_mask() {
     __ align(CodeEntryAlignment);
@@ -3848,6 +4093,370 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  /**
+   *  Arguments:
+   *
+   *  Inputs:
+   *   c_rarg0   - int crc
+   *   c_rarg1   - byte* buf
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int crc result
+   */
+  address generate_updateBytesCRC32C() {
+    assert(UseCRC32CIntrinsics, "need SSE4.2 instructions");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesCRC32C");
+
+    address start = __ pc();
+    const Register crc = c_rarg0;  // crc
+    const Register buf = c_rarg1;  // source java byte array address
+    const Register len = c_rarg2;  // length
+    const Register end = r11;      // end of source
+    const Register tmp = r10;
+    assert_different_registers(crc, buf, len, end, tmp, rax);
+
+    Label L_loop32, L_loop8, L_tail, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movl(rax, crc);
+    __ movslq(len, len);
+    __ lea(end, Address(buf, len, Address::times_1));
+
+    // 8 bytes per crc32 instruction, four per iteration.
+    __ bind(L_loop32);
+    __ lea(tmp, Address(buf, 32));
+    __ cmpptr(tmp, end);
+    __ jcc(Assembler::above, L_loop8);
+    __ crc32(rax, Address(buf,  0), 8);
+    __ crc32(rax, Address(buf,  8), 8);
+    __ crc32(rax, Address(buf, 16), 8);
+    __ crc32(rax, Address(buf, 24), 8);
+    __ addptr(buf, 32);
+    __ jmp(L_loop32);
+
+    __ bind(L_loop8);
+    __ lea(tmp, Address(buf, 8));
+    __ cmpptr(tmp, end);
+    __ jcc(Assembler::above, L_tail);
+    __ crc32(rax, Address(buf, 0), 8);
+    __ addptr(buf, 8);
+    __ jmp(L_loop8);
+
+    __ bind(L_tail);
+    __ cmpptr(buf, end);
+    __ jcc(Assembler::aboveEqual, L_exit);
+    __ crc32(rax, Address(buf, 0), 1);
+    __ incrementq(buf);
+    __ jmp(L_tail);
+
+    __ bind(L_exit);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Arguments:
+   *
+   *  Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buff
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int adler result
+   *
+   * 16 bytes b[0..15] added to the sums give
+   *   s1 += b[0] + ... + b[15]
+   *   s2 += 16 * s1 + 16 * b[0] + 15 * b[1] + ... + 1 * b[15]
+   * The weighted and the plain byte sums are accumulated in vectors for
+   * up to NMAX bytes, the largest count for which the sums can not
+   * overflow, and reduced modulo BASE after that.
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need SSSE3 instructions");
+
+    const int BASE = 65521;
+    const int NMAX = 5552;  // multiple of 16
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+
+    // Weights 16..1 for the bytes of a 16 byte chunk, and 16-bit ones
+    // to add adjacent words.
+    address weights = __ pc();
+    __ emit_data64(0x090A0B0C0D0E0F10, relocInfo::none);
+    __ emit_data64(0x0102030405060708, relocInfo::none);
+    address ones = __ pc();
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+
+    __ align(CodeEntryAlignment);
+    address start = __ pc();
+
+    const Register s1   = r9;
+    const Register s2   = r10;
+    const Register buf  = r11;
+    const Register len  = r8;
+    const Register cnt  = rcx;
+    // rax and rdx are used for the divisions
+
+    const XMMRegister xdata   = xmm0;
+    const XMMRegister xtmp    = xmm1;
+    const XMMRegister xzero   = xmm2;
+    const XMMRegister xweight = xmm3;
+    const XMMRegister xones   = xmm4;
+    const XMMRegister xsum    = xmm5;  // byte sums, 2 x 64 bits
+    const XMMRegister xprefix = xmm6;  // sums of the byte sums before each chunk
+    const XMMRegister xwsum   = xmm7;  // weighted byte sums, 4 x 32 bits
+
+    Label L_block, L_count, L_chunk, L_tail, L_tail_loop, L_done;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+#ifdef _WIN64
+    // xmm6 and xmm7 are callee saved on Win64.
+    __ subptr(rsp, 2 * 16);
+    __ movdqu(Address(rsp, 0), xmm6);
+    __ movdqu(Address(rsp, 16), xmm7);
+#endif
+
+    __ movdqu(xweight, ExternalAddress(weights));
+    __ movdqu(xones, ExternalAddress(ones));
+    __ pxor(xzero, xzero);
+
+    // Win64 passes the arguments in rcx, rdx, r8; Unix in rdi, rsi, rdx.
+    __ movl(s1, c_rarg0);
+    __ movl(s2, c_rarg0);
+    __ andl(s1, 0xFFFF);
+    __ shrl(s2, 16);
+    __ movptr(buf, c_rarg1);
+    __ movslq(len, c_rarg2);
+
+    __ bind(L_block);
+    __ cmpl(len, 16);
+    __ jcc(Assembler::less, L_tail);
+    __ movl(cnt, len);
+    __ cmpl(cnt, NMAX);
+    __ jcc(Assembler::lessEqual, L_count);
+    __ movl(cnt, NMAX);
+    __ bind(L_count);
+    __ shrl(cnt, 4);               // whole 16 byte chunks in this block
+    __ movl(rax, cnt);
+    __ shll(rax, 4);
+    __ subl(len, rax);
+    // s1 is added to s2 once per byte of the block
+    __ imulq(rax, s1);
+    __ addq(s2, rax);
+
+    __ pxor(xsum, xsum);
+    __ pxor(xprefix, xprefix);
+    __ pxor(xwsum, xwsum);
+
+    __ align(OptoLoopAlignment);
+    __ bind(L_chunk);
+    __ movdqu(xdata, Address(buf, 0));
+    __ addptr(buf, 16);
+    __ paddq(xprefix, xsum);
+    __ movdqa(xtmp, xdata);
+    __ psadbw(xtmp, xzero);
+    __ paddq(xsum, xtmp);
+    __ pmaddubsw(xdata, xweight);
+    __ pmaddwd(xdata, xones);
+    __ paddd(xwsum, xdata);
+    __ decrementl(cnt);
+    __ jcc(Assembler::notZero, L_chunk);
+
+    // s1 += byte sum
+    __ pshufd(xtmp, xsum, 0x4E);
+    __ paddq(xsum, xtmp);
+    __ movdq(rax, xsum);
+    __ addq(s1, rax);
+    // s2 += 16 * prefix sum + weighted sum
+    __ pshufd(xtmp, xprefix, 0x4E);
+    __ paddq(xprefix, xtmp);
+    __ movdq(rax, xprefix);
+    __ shlq(rax, 4);
+    __ addq(s2, rax);
+    __ pshufd(xtmp, xwsum, 0x4E);
+    __ paddd(xwsum, xtmp);
+    __ pshufd(xtmp, xwsum, 0xB1);
+    __ paddd(xwsum, xtmp);
+    __ movdl(rax, xwsum);
+    __ addq(s2, rax);
+
+    // s1 %= BASE, s2 %= BASE
+    __ movl(cnt, BASE);
+    __ movq(rax, s1);
+    __ xorl(rdx, rdx);
+    __ idivq(cnt);
+    __ movq(s1, rdx);
+    __ movq(rax, s2);
+    __ xorl(rdx, rdx);
+    __ idivq(cnt);
+    __ movq(s2, rdx);
+    __ jmp(L_block);
+
+    // Fewer than 16 bytes left
+    __ bind(L_tail);
+    __ testl(len, len);
+    __ jcc(Assembler::zero, L_done);
+    __ bind(L_tail_loop);
+    __ movzbl(rax, Address(buf, 0));
+    __ incrementq(buf);
+    __ addl(s1, rax);
+    __ addl(s2, s1);
+    __ decrementl(len);
+    __ jcc(Assembler::notZero, L_tail_loop);
+    __ movl(cnt, BASE);
+    __ movl(rax, s1);
+    __ xorl(rdx, rdx);
+    __ divl(cnt);
+    __ movl(s1, rdx);
+    __ movl(rax, s2);
+    __ xorl(rdx, rdx);
+    __ divl(cnt);
+    __ movl(s2, rdx);
+
+    __ bind(L_done);
+    __ shll(s2, 16);
+    __ orl(s2, s1);
+    __ movl(rax, s2);
+
+#ifdef _WIN64
+    __ movdqu(xmm6, Address(rsp, 0));
+    __ movdqu(xmm7, Address(rsp, 16));
+    __ addptr(rsp, 2 * 16);
+#endif
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Arguments:
+   *
+   *  Input:
+   *    c_rarg0   - obja address
+   *    c_rarg1   - objb address
+   *    c_rarg2   - length, in elements
+   *    c_rarg3   - log2 of the element size
+   *
+   *  Output:
+   *        rax   - index of the first mismatching element, or -1
+   */
+  address generate_vectorizedMismatch() {
+    assert(UseVectorizedMismatchIntrinsic, "need SSE4.1 instructions");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedMismatch");
+    address start = __ pc();
+
+    Register obja   = c_rarg0;
+    Register objb   = c_rarg1;
+    Register length = c_rarg2;
+    Register scale  = c_rarg3;
+    const Register idx  = rax;  // byte index, element index on exit
+    const Register tmp1 = r11;
+    const Register tmp2 = r9;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+#ifdef _WIN64
+    // The shifts below need the scale in rcx, which holds obja on Win64.
+    __ movptr(r10, obja);
+    __ movl(rcx, scale);
+    obja  = r10;
+    scale = rcx;
+#endif
+    assert(scale == rcx, "shift count");
+    assert_different_registers(obja, objb, length, scale, idx, tmp1, tmp2);
+
+    Label L_loop32, L_loop16, L_loop8, L_found8, L_tail, L_done, L_equal, L_exit;
+
+    // Compare in bytes; the first differing byte lies in the first
+    // differing element.
+    __ movslq(length, length);
+    __ shlq(length);
+    __ xorl(idx, idx);
+
+    if (UseAVX >= 2) {
+      __ bind(L_loop32);
+      __ leaq(tmp1, Address(idx, 32));
+      __ cmpq(tmp1, length);
+      __ jcc(Assembler::greater, L_loop16);
+      __ vmovdqu(xmm0, Address(obja, idx, Address::times_1));
+      __ vpxor(xmm0, xmm0, Address(objb, idx, Address::times_1), true);
+      __ vptest(xmm0, xmm0);
+      __ jcc(Assembler::notZero, L_loop8);  // locate it 8 bytes at a time
+      __ addq(idx, 32);
+      __ jmp(L_loop32);
+    }
+
+    __ bind(L_loop16);
+    __ leaq(tmp1, Address(idx, 16));
+    __ cmpq(tmp1, length);
+    __ jcc(Assembler::greater, L_loop8);
+    __ movdqu(xmm0, Address(obja, idx, Address::times_1));
+    __ movdqu(xmm1, Address(objb, idx, Address::times_1));
+    __ pxor(xmm0, xmm1);
+    __ ptest(xmm0, xmm0);
+    __ jcc(Assembler::notZero, L_loop8);
+    __ addq(idx, 16);
+    __ jmp(L_loop16);
+
+    __ bind(L_loop8);
+    __ leaq(tmp1, Address(idx, 8));
+    __ cmpq(tmp1, length);
+    __ jcc(Assembler::greater, L_tail);
+    __ movq(tmp1, Address(obja, idx, Address::times_1));
+    __ xorq(tmp1, Address(objb, idx, Address::times_1));
+    __ jcc(Assembler::notZero, L_found8);
+    __ addq(idx, 8);
+    __ jmp(L_loop8);
+
+    __ bind(L_found8);
+    // Little endian: the lowest set bit is in the first differing byte.
+    __ bsfq(tmp1, tmp1);
+    __ shrq(tmp1, 3);
+    __ addq(idx, tmp1);
+    __ jmp(L_done);
+
+    __ bind(L_tail);
+    __ cmpq(idx, length);
+    __ jcc(Assembler::greaterEqual, L_equal);
+    __ movzbl(tmp1, Address(obja, idx, Address::times_1));
+    __ movzbl(tmp2, Address(objb, idx, Address::times_1));
+    __ cmpl(tmp1, tmp2);
+    __ jcc(Assembler::notEqual, L_done);
+    __ incrementq(idx);
+    __ jmp(L_tail);
+
+    __ bind(L_done);
+    __ shrq(idx);  // byte index to element index
+    __ jmp(L_exit);
+
+    __ bind(L_equal);
+    __ movl(rax, -1);
+
+    __ bind(L_exit);
+    if (UseAVX >= 2) {
+      __ vzeroupper();
+    }
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
 
   /**
    *  Arguments:
@@ -4191,6 +4800,12 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_crc_table_adr = (address)StubRoutines::x86::_crc_table;
       StubRoutines::_updateBytesCRC32 = generate_updateBytesCRC32();
     }
+    if (UseCRC32CIntrinsics) {
+      StubRoutines::_updateBytesCRC32C = generate_updateBytesCRC32C();
+    }
+    if (UseAdler32Intrinsics) {
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
   }
 
   void generate_all() {
@@ -4244,6 +4859,15 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_aescrypt_decryptBlock = generate_aescrypt_decryptBlock();
       StubRoutines::_cipherBlockChaining_encryptAESCrypt = generate_cipherBlockChaining_encryptAESCrypt();
       StubRoutines::_cipherBlockChaining_decryptAESCrypt = generate_cipherBlockChaining_decryptAESCrypt_Parallel();
+      if (UseAESCTRIntrinsics) {
+        StubRoutines::x86::_counter_shuffle_mask_addr = generate_counter_shuffle_mask();
+        StubRoutines::_counterMode_AESCrypt = generate_counterMode_AESCrypt_Parallel();
+      }
+    }
+
+    // Lives in the StubRoutines (2) blob; code_size2 budgets for it.
+    if (UseVectorizedMismatchIntrinsic) {
+      StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
 
     // Generate GHASH intrinsics code
@@ -32,8 +32,8 @@
 static bool    returns_to_call_stub(address return_pc)   { return return_pc == _call_stub_return_address; }
 
 enum platform_dependent_constants {
-  code_size1 = 19000,          // simply increase if too small (assembler will crash if too small)
-  code_size2 = 24000           // simply increase if too small (assembler will crash if too small)
+  code_size1 = 23000,          // simply increase if too small (assembler will crash if too small)
+  code_size2 = 35000           // simply increase if too small (assembler will crash if too small)
 };
 
 class x86 {
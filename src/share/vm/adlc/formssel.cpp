@@ -4113,7 +4113,13 @@ bool MatchRule::is_vector() const {
     "SubVB","SubVS","SubVI","SubVL","SubVF","SubVD",
     "MulVS","MulVI","MulVF","MulVD",
     "DivVF","DivVD",
+    "FmaVD","FmaVF",
     "AndV" ,"XorV" ,"OrV",
+    "AddReductionVI", "AddReductionVL", "AddReductionVF", "AddReductionVD",
+    "MulReductionVI", "MulReductionVF", "MulReductionVD",
+    "MinReductionVI", "MaxReductionVI",
+    "AndReductionVI", "AndReductionVL", "OrReductionVI", "OrReductionVL",
+    "XorReductionVI", "XorReductionVL",
     "LShiftCntV","RShiftCntV",
     "LShiftVB","LShiftVS","LShiftVI","LShiftVL",
     "RShiftVB","RShiftVS","RShiftVI","RShiftVL",
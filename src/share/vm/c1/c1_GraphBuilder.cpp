@@ -37,6 +37,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 class BlockListBuilder VALUE_OBJ_CLASS_SPEC {
@@ -3670,6 +3671,26 @@ bool GraphBuilder::try_inline_intrinsics(ciMethod* callee) {
       preserves_state = true;
       break;
 
+    case vmIntrinsics::_updateBytesCRC32C:
+    case vmIntrinsics::_updateDirectByteBufferCRC32C:
+      if (!UseCRC32CIntrinsics || StubRoutines::updateBytesCRC32C() == NULL) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
+    case vmIntrinsics::_updateBytesAdler32:
+    case vmIntrinsics::_updateByteBufferAdler32:
+      if (!UseAdler32Intrinsics || StubRoutines::updateBytesAdler32() == NULL) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
+    case vmIntrinsics::_vectorizedMismatch:
+      if (!UseVectorizedMismatchIntrinsic || StubRoutines::vectorizedMismatch() == NULL) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
     case vmIntrinsics::_loadFence :
     case vmIntrinsics::_storeFence:
     case vmIntrinsics::_fullFence :
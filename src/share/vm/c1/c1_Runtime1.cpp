@@ -301,6 +301,9 @@ const char* Runtime1::name_for_address(address entry) {
   FUNCTION_CASE(entry, JFR_TIME_FUNCTION);
 #endif
   FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32C());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesAdler32());
+  FUNCTION_CASE(entry, StubRoutines::vectorizedMismatch());
 
 #undef FUNCTION_CASE
 
@@ -51,6 +51,7 @@ SymbolTable* SymbolTable::_the_table = NULL;
 // Static arena for symbols that are not deallocated
 Arena* SymbolTable::_arena = NULL;
 bool SymbolTable::_needs_rehashing = false;
+bool SymbolTable::_needs_resizing = false;
 
 Symbol* SymbolTable::allocate_symbol(const u1* name, int len, bool c_heap, TRAPS) {
   assert (len <= Symbol::max_length(), "should be checked by caller");
@@ -186,7 +187,7 @@ void SymbolTable::rehash_table() {
   // This should never happen with -Xshare:dump but it might in testing mode.
   if (DumpSharedSpaces) return;
   // Create a new symbol table
-  SymbolTable* new_table = new SymbolTable();
+  SymbolTable* new_table = new SymbolTable(the_table()->table_size());
 
   the_table()->move_to(new_table);
 
@@ -198,6 +199,22 @@ void SymbolTable::rehash_table() {
   _the_table = new_table;
 }
 
+// Create a larger table and populate it with the existing symbols.
+// Lookups are lock-free, so this is only done at a safepoint.
+void SymbolTable::resize_table() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // The table is about to be written to the archive.
+  if (DumpSharedSpaces) return;
+  SymbolTable* new_table = new SymbolTable(the_table()->grown_table_size());
+
+  the_table()->resize_to(new_table);
+
+  // Delete the table and buckets (entries are reused in new table).
+  delete _the_table;
+  _needs_resizing = false;
+  _the_table = new_table;
+}
+
 // Lookup a symbol in a bucket.
 
 Symbol* SymbolTable::lookup(int index, const char* name,
@@ -249,7 +266,7 @@ Symbol* SymbolTable::lookup(const char* name, int len, TRAPS) {
   MutexLocker ml(SymbolTable_lock, THREAD);
 
   // Otherwise, add to symbol to table
-  return the_table()->basic_add(index, (u1*)name, len, hashValue, true, THREAD);
+  return the_table()->basic_add((u1*)name, len, hashValue, true, THREAD);
 }
 
 Symbol* SymbolTable::lookup(const Symbol* sym, int begin, int end, TRAPS) {
@@ -288,7 +305,7 @@ Symbol* SymbolTable::lookup(const Symbol* sym, int begin, int end, TRAPS) {
   // Grab SymbolTable_lock first.
   MutexLocker ml(SymbolTable_lock, THREAD);
 
-  return the_table()->basic_add(index, (u1*)buffer, len, hashValue, true, THREAD);
+  return the_table()->basic_add((u1*)buffer, len, hashValue, true, THREAD);
 }
 
 Symbol* SymbolTable::lookup_only(const char* name, int len,
@@ -365,9 +382,8 @@ void SymbolTable::add(ClassLoaderData* loader_data, constantPoolHandle cp,
   if (!added) {
     // do it the hard way
     for (int i=0; i<names_count; i++) {
-      int index = table->hash_to_index(hashValues[i]);
       bool c_heap = !loader_data->is_the_null_class_loader_data();
-      Symbol* sym = table->basic_add(index, (u1*)names[i], lengths[i], hashValues[i], c_heap, CHECK);
+      Symbol* sym = table->basic_add((u1*)names[i], lengths[i], hashValues[i], c_heap, CHECK);
       cp->symbol_at_put(cp_indices[i], sym);
     }
   }
@@ -382,12 +398,10 @@ Symbol* SymbolTable::new_permanent_symbol(const char* name, TRAPS) {
   // Grab SymbolTable_lock first.
   MutexLocker ml(SymbolTable_lock, THREAD);
 
-  SymbolTable* table = the_table();
-  int index = table->hash_to_index(hash);
-  return table->basic_add(index, (u1*)name, (int)strlen(name), hash, false, THREAD);
+  return the_table()->basic_add((u1*)name, (int)strlen(name), hash, false, THREAD);
 }
 
-Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
+Symbol* SymbolTable::basic_add(u1 *name, int len,
                                unsigned int hashValue_arg, bool c_heap, TRAPS) {
   assert(!Universe::heap()->is_in_reserved(name),
          "proposed name of symbol must be stable");
@@ -402,16 +416,15 @@ Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
   No_Safepoint_Verifier nsv;
 
   // Check if the symbol table has been rehashed, if so, need to recalculate
-  // the hash value and index.
+  // the hash value.  The table may also have been resized while waiting
+  // for the lock, so always recalculate the index.
   unsigned int hashValue;
-  int index;
   if (use_alternate_hashcode()) {
     hashValue = hash_symbol((const char*)name, len);
-    index = hash_to_index(hashValue);
   } else {
     hashValue = hashValue_arg;
-    index = index_arg;
   }
+  int index = hash_to_index(hashValue);
 
   // Since look-up was done lock-free, we need to check if another
   // thread beat us in the race to insert the symbol.
@@ -428,6 +441,9 @@ Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
 
   HashtableEntry<Symbol*, mtSymbol>* entry = new_entry(hashValue, sym);
   add_entry(index, entry);
+  if (!needs_resizing() && check_grow_table()) {
+    _needs_resizing = true;
+  }
   return sym;
 }
 
@@ -479,6 +495,9 @@ bool SymbolTable::basic_add(ClassLoaderData* loader_data, constantPoolHandle cp,
       cp->symbol_at_put(cp_indices[i], sym);
     }
   }
+  if (!needs_resizing() && check_grow_table()) {
+    _needs_resizing = true;
+  }
   return true;
 }
 
@@ -646,6 +665,8 @@ StringTable* StringTable::_the_table = NULL;
 
 bool StringTable::_needs_rehashing = false;
 
+bool StringTable::_needs_resizing = false;
+
 volatile int StringTable::_parallel_claimed_idx = 0;
 
 // Pick hashing algorithm
@@ -673,7 +694,7 @@ oop StringTable::lookup(int index, jchar* name,
 }
 
 
-oop StringTable::basic_add(int index_arg, Handle string, jchar* name,
+oop StringTable::basic_add(Handle string, jchar* name,
                            int len, unsigned int hashValue_arg, TRAPS) {
 
   assert(java_lang_String::equals(string(), name, len),
@@ -682,16 +703,15 @@ oop StringTable::basic_add(int index_arg, Handle string, jchar* name,
   No_Safepoint_Verifier nsv;
 
   // Check if the symbol table has been rehashed, if so, need to recalculate
-  // the hash value and index before second lookup.
+  // the hash value before second lookup.  The table may also have been
+  // resized while waiting for the lock, so always recalculate the index.
   unsigned int hashValue;
-  int index;
   if (use_alternate_hashcode()) {
     hashValue = hash_string(name, len);
-    index = hash_to_index(hashValue);
   } else {
     hashValue = hashValue_arg;
-    index = index_arg;
   }
+  int index = hash_to_index(hashValue);
 
   // Since look-up was done lock-free, we need to check if another
   // thread beat us in the race to insert the symbol.
@@ -704,6 +724,9 @@ oop StringTable::basic_add(int index_arg, Handle string, jchar* name,
 
   HashtableEntry<oop, mtSymbol>* entry = new_entry(hashValue, string());
   add_entry(index, entry);
+  if (!needs_resizing() && check_grow_table()) {
+    _needs_resizing = true;
+  }
   return string();
 }
 
@@ -777,7 +800,7 @@ oop StringTable::intern(Handle string_or_null, jchar* name,
   {
     MutexLocker ml(StringTable_lock, THREAD);
     // Otherwise, add to symbol to table
-    added_or_found = the_table()->basic_add(index, string, name, len,
+    added_or_found = the_table()->basic_add(string, name, len,
                                   hashValue, CHECK_NULL);
   }
 
@@ -1109,7 +1132,7 @@ void StringTable::rehash_table() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
   // This should never happen with -Xshare:dump but it might in testing mode.
   if (DumpSharedSpaces) return;
-  StringTable* new_table = new StringTable();
+  StringTable* new_table = new StringTable(the_table()->table_size());
 
   // Rehash the table
   the_table()->move_to(new_table);
@@ -1121,3 +1144,19 @@ void StringTable::rehash_table() {
   _needs_rehashing = false;
   _the_table = new_table;
 }
+
+// Create a larger table and populate it with the existing strings.
+// Lookups are lock-free, so this is only done at a safepoint.
+void StringTable::resize_table() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // This should never happen with -Xshare:dump but it might in testing mode.
+  if (DumpSharedSpaces) return;
+  StringTable* new_table = new StringTable(the_table()->grown_table_size());
+
+  the_table()->resize_to(new_table);
+
+  // Delete the table and buckets (entries are reused in new table).
+  delete _the_table;
+  _needs_resizing = false;
+  _the_table = new_table;
+}
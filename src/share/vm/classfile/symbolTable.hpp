@@ -34,7 +34,10 @@
 //
 // The interned strings are created lazily.
 //
-// It is implemented as an open hash table with a fixed number of buckets.
+// It is implemented as an open hash table.  Lookups are lock-free, adding
+// takes the SymbolTable_lock or StringTable_lock.  When the average bucket
+// length grows too large the elements are moved into a larger table at the
+// next safepoint.
 //
 // %note:
 //  - symbolTableEntrys are allocated in blocks to reduce the space overhead.
@@ -85,6 +88,9 @@ private:
   // Set if one bucket is out of balance due to hash algorithm deficiency
   static bool _needs_rehashing;
 
+  // Set if the table holds too many symbols for its number of buckets
+  static bool _needs_resizing;
+
   // For statistics
   static int _symbols_removed;
   static int _symbols_counted;
@@ -92,7 +98,7 @@ private:
   Symbol* allocate_symbol(const u1* name, int len, bool c_heap, TRAPS); // Assumes no characters larger than 0x7F
 
   // Adding elements
-  Symbol* basic_add(int index, u1* name, int len, unsigned int hashValue,
+  Symbol* basic_add(u1* name, int len, unsigned int hashValue,
                     bool c_heap, TRAPS);
   bool basic_add(ClassLoaderData* loader_data,
                  constantPoolHandle cp, int names_count,
@@ -109,8 +115,8 @@ private:
 
   Symbol* lookup(int index, const char* name, int len, unsigned int hash);
 
-  SymbolTable()
-    : RehashableHashtable<Symbol*, mtSymbol>(SymbolTableSize, sizeof (HashtableEntry<Symbol*, mtSymbol>)) {}
+  SymbolTable(int table_size)
+    : RehashableHashtable<Symbol*, mtSymbol>(table_size, sizeof (HashtableEntry<Symbol*, mtSymbol>)) {}
 
   SymbolTable(HashtableBucket<mtSymbol>* t, int number_of_entries)
     : RehashableHashtable<Symbol*, mtSymbol>(SymbolTableSize, sizeof (HashtableEntry<Symbol*, mtSymbol>), t,
@@ -144,7 +150,7 @@ public:
 
   static void create_table() {
     assert(_the_table == NULL, "One symbol table allowed.");
-    _the_table = new SymbolTable();
+    _the_table = new SymbolTable((int)SymbolTableSize);
     initialize_symbols(symbol_alloc_arena_size);
   }
 
@@ -250,6 +256,9 @@ public:
   // Rehash the symbol table if it gets out of balance
   static void rehash_table();
   static bool needs_rehashing()         { return _needs_rehashing; }
+  // Grow the symbol table if it gets too full
+  static void resize_table();
+  static bool needs_resizing()          { return _needs_resizing; }
   // Parallel chunked scanning
   static void clear_parallel_claimed_index() { _parallel_claimed_idx = 0; }
   static int parallel_claimed_index()        { return _parallel_claimed_idx; }
@@ -265,11 +274,14 @@ private:
   // Set if one bucket is out of balance due to hash algorithm deficiency
   static bool _needs_rehashing;
 
+  // Set if the table holds too many strings for its number of buckets
+  static bool _needs_resizing;
+
   // Claimed high water mark for parallel chunked scanning
   static volatile int _parallel_claimed_idx;
 
   static oop intern(Handle string_or_null, jchar* chars, int length, TRAPS);
-  oop basic_add(int index, Handle string_or_null, jchar* name, int len,
+  oop basic_add(Handle string_or_null, jchar* name, int len,
                 unsigned int hashValue, TRAPS);
 
   oop lookup(int index, jchar* chars, int length, unsigned int hashValue);
@@ -285,7 +297,7 @@ private:
   // This allows multiple threads to work on the table at once.
   static void buckets_unlink_or_oops_do(BoolObjectClosure* is_alive, OopClosure* f, int start_idx, int end_idx, BucketUnlinkContext* context);
 
-  StringTable() : RehashableHashtable<oop, mtSymbol>((int)StringTableSize,
+  StringTable(int table_size) : RehashableHashtable<oop, mtSymbol>(table_size,
                               sizeof (HashtableEntry<oop, mtSymbol>)) {}
 
   StringTable(HashtableBucket<mtSymbol>* t, int number_of_entries)
@@ -300,7 +312,7 @@ public:
 
   static void create_table() {
     assert(_the_table == NULL, "One string table allowed.");
-    _the_table = new StringTable();
+    _the_table = new StringTable((int)StringTableSize);
   }
 
   // GC support
@@ -385,6 +397,10 @@ public:
   static void rehash_table();
   static bool needs_rehashing() { return _needs_rehashing; }
 
+  // Grow the string table if it gets too full
+  static void resize_table();
+  static bool needs_resizing() { return _needs_resizing; }
+
   // Parallel chunked scanning
   static void clear_parallel_claimed_index() { _parallel_claimed_idx = 0; }
   static int parallel_claimed_index() { return _parallel_claimed_idx; }
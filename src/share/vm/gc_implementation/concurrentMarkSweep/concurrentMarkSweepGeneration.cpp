@@ -5293,6 +5293,47 @@ void CMSParInitialMarkTask::work(uint worker_id) {
 }
 
 // Parallel remark task
+// Splits the dirty card rescan tasks of the CMS space into one stripe of
+// consecutive tasks per remark worker. A worker claims the tasks of its own
+// stripe in address order and then moves on to the other stripes, so that
+// stripes with many dirty cards do not leave the other workers idle.
+class CMSRescanStripes : public StackObj {
+  struct Stripe {
+    volatile jint _next;
+    jint          _end;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, 2 * sizeof(jint));
+  };
+  Stripe* _stripes;
+  uint    _n_stripes;
+
+ public:
+  CMSRescanStripes(uint n_stripes, uint n_tasks) : _n_stripes(n_stripes) {
+    assert(n_stripes > 0, "no stripes");
+    _stripes = NEW_C_HEAP_ARRAY(Stripe, n_stripes, mtGC);
+    for (uint i = 0; i < n_stripes; i++) {
+      _stripes[i]._next = (jint)(((julong)n_tasks * i) / n_stripes);
+      _stripes[i]._end  = (jint)(((julong)n_tasks * (i + 1)) / n_stripes);
+    }
+  }
+  ~CMSRescanStripes() { FREE_C_HEAP_ARRAY(Stripe, _stripes, mtGC); }
+
+  uint n_stripes() const { return _n_stripes; }
+
+  // Claims the next task of the given stripe; returns false if it has none left.
+  bool claim(uint stripe, uint& task) {
+    Stripe* s = &_stripes[stripe];
+    if (s->_next >= s->_end) {
+      return false;
+    }
+    jint t = Atomic::add(1, &s->_next) - 1;
+    if (t >= s->_end) {
+      return false;
+    }
+    task = (uint)t;
+    return true;
+  }
+};
+
 class CMSParRemarkTask: public CMSParMarkTask {
   CompactibleFreeListSpace* _cms_space;
 
@@ -5300,6 +5341,9 @@ class CMSParRemarkTask: public CMSParMarkTask {
   OopTaskQueueSet*       _task_queues;
   ParallelTaskTerminator _term;
 
+  // Dirty card rescan tasks per worker, or NULL to claim them in sequence.
+  CMSRescanStripes*      _stripes;
+
  public:
   // A value of 0 passed to n_workers will cause the number of
   // workers to be taken from the active workers in the work gang.
@@ -5311,7 +5355,10 @@ class CMSParRemarkTask: public CMSParMarkTask {
                    collector, n_workers),
     _cms_space(cms_space),
     _task_queues(task_queues),
-    _term(n_workers, task_queues) { }
+    _term(n_workers, task_queues),
+    _stripes(NULL) { }
+
+  void set_rescan_stripes(CMSRescanStripes* stripes) { _stripes = stripes; }
 
   OopTaskQueueSet* task_queues() { return _task_queues; }
 
@@ -5326,6 +5373,8 @@ class CMSParRemarkTask: public CMSParMarkTask {
   // ... of  dirty cards in old space
   void do_dirty_card_rescan_tasks(CompactibleFreeListSpace* sp, int i,
                                   Par_MarkRefsIntoAndScanClosure* cl);
+  bool claim_rescan_task(SequentialSubTasksDone* pst, int i,
+                         uint& stripe, uint& nth_task);
 
   // ... work stealing for the above
   void do_work_steal(int i, Par_MarkRefsIntoAndScanClosure* cl, int* seed);
@@ -5582,6 +5631,8 @@ CMSParRemarkTask::do_dirty_card_rescan_tasks(
   // card ranges (chunks) in monotonically increasing order globally
   // and, a-fortiori, in monotonically increasing order per thread
   // (the latter order being a subsequence of the former).
+  // With CMSStripedRescan a thread that moves on to a stripe below
+  // the ones it has scanned resets that state before continuing.
   // If the work code below is ever reorganized into a more chaotic
   // work-partitioning form than the current "sequential tasks"
   // paradigm, the use of that persistent state will have to be
@@ -5614,7 +5665,13 @@ CMSParRemarkTask::do_dirty_card_rescan_tasks(
   assert((size_t)round_to((intptr_t)chunk_size, alignment) ==
          chunk_size, "Check alignment");
 
-  while (!pst->is_task_claimed(/* reference */ nth_task)) {
+  uint stripe = 0;
+  uint last_task = 0;
+  while (claim_rescan_task(pst, i, stripe, nth_task)) {
+    if (nth_task < last_task) {
+      greyRescanClosure.reset_previous();
+    }
+    last_task = nth_task;
     // Having claimed the nth_task, compute corresponding mem-region,
     // which is a-fortiori aligned correctly (i.e. at a MUT bopundary).
     // The alignment restriction ensures that we do not need any
@@ -5649,6 +5706,24 @@ CMSParRemarkTask::do_dirty_card_rescan_tasks(
   pst->all_tasks_completed();  // declare that i am done
 }
 
+// Claims the next dirty card rescan task for worker i: in global sequence,
+// or from the worker's own stripe and then from the stripes after it.
+// 'stripe' counts the stripes the worker has exhausted.
+bool
+CMSParRemarkTask::claim_rescan_task(SequentialSubTasksDone* pst, int i,
+                                    uint& stripe, uint& nth_task) {
+  if (_stripes == NULL) {
+    return !pst->is_task_claimed(/* reference */ nth_task);
+  }
+  uint n_stripes = _stripes->n_stripes();
+  for (; stripe < n_stripes; stripe++) {
+    if (_stripes->claim((i + stripe) % n_stripes, nth_task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // . see if we can share work_queues with ParNew? XXX
 void
 CMSParRemarkTask::do_work_steal(int i, Par_MarkRefsIntoAndScanClosure* cl,
@@ -5915,8 +5990,13 @@ void CMSCollector::do_remark_parallel() {
 
   // The dirty card rescan work is broken up into a "sequence"
   // of parallel tasks (per constituent space) that are dynamically
-  // claimed by the parallel threads.
+  // claimed by the parallel threads, either in sequence or, with
+  // CMSStripedRescan, from per-worker stripes with stealing.
   cms_space->initialize_sequential_subtasks_for_rescan(n_workers);
+  CMSRescanStripes stripes(n_workers, cms_space->conc_par_seq_tasks()->n_tasks());
+  if (CMSStripedRescan) {
+    tsk.set_rescan_stripes(&stripes);
+  }
 
   // It turns out that even when we're using 1 thread, doing the work in a
   // separate thread causes wide variance in run times.  We can't help this
@@ -6068,6 +6148,7 @@ class CMSRefProcTaskProxy: public AbstractGangTaskWOopQueues {
   CMSBitMap*             _mark_bit_map;
   const MemRegion        _span;
   ProcessTask&           _task;
+  uint                   _ergo_workers;
 
 public:
   CMSRefProcTaskProxy(ProcessTask&     task,
@@ -6075,7 +6156,8 @@ public:
                       const MemRegion& span,
                       CMSBitMap*       mark_bit_map,
                       AbstractWorkGang* workers,
-                      OopTaskQueueSet* task_queues):
+                      OopTaskQueueSet* task_queues,
+                      uint             ergo_workers):
     // XXX Should superclass AGTWOQ also know about AWG since it knows
     // about the task_queues used by the AWG? Then it could initialize
     // the terminator() object. See 6984287. The set_for_termination()
@@ -6083,13 +6165,19 @@ public:
     AbstractGangTaskWOopQueues("Process referents by policy in parallel",
       task_queues),
     _task(task),
-    _collector(collector), _span(span), _mark_bit_map(mark_bit_map)
+    _collector(collector), _span(span), _mark_bit_map(mark_bit_map),
+    _ergo_workers(ergo_workers)
   {
     assert(_collector->_span.equals(_span) && !_span.is_empty(),
            "Inconsistency in _span");
     set_for_termination(workers->active_workers());
   }
 
+  // Only the first _ergo_workers workers take part in termination.
+  virtual void set_for_termination(int active_workers) {
+    AbstractGangTaskWOopQueues::set_for_termination(MIN2(active_workers, (int)_ergo_workers));
+  }
+
   OopTaskQueueSet* task_queues() { return queues(); }
 
   OopTaskQueue* work_queue(int i) { return task_queues()->queue(i); }
@@ -6103,6 +6191,10 @@ public:
 };
 
 void CMSRefProcTaskProxy::work(uint worker_id) {
+  if (worker_id >= _ergo_workers) {
+    // The reference lists of this worker are empty.
+    return;
+  }
   ResourceMark rm;
   HandleMark hm;
   assert(_collector->_span.equals(_span), "Inconsistency in _span");
@@ -6199,7 +6291,7 @@ void CMSRefProcTaskProxy::do_work_steal(int i,
   )
 }
 
-void CMSRefProcTaskExecutor::execute(ProcessTask& task)
+void CMSRefProcTaskExecutor::execute(ProcessTask& task, uint ergo_workers)
 {
   GenCollectedHeap* gch = GenCollectedHeap::heap();
   FlexibleWorkGang* workers = gch->workers();
@@ -6207,7 +6299,8 @@ void CMSRefProcTaskExecutor::execute(ProcessTask& task)
   CMSRefProcTaskProxy rp_task(task, &_collector,
                               _collector.ref_processor()->span(),
                               _collector.markBitMap(),
-                              workers, _collector.task_queues());
+                              workers, _collector.task_queues(),
+                              ergo_workers);
   workers->run_task(&rp_task);
 }
 
@@ -504,7 +504,7 @@ public:
   { }
 
   // Executes a task using worker threads.
-  virtual void execute(ProcessTask& task);
+  virtual void execute(ProcessTask& task, uint ergo_workers);
   virtual void execute(EnqueueTask& task);
 private:
   CMSCollector& _collector;
@@ -1620,6 +1620,9 @@ class MarkFromDirtyCardsClosure: public MemRegionClosure {
   void do_MemRegion(MemRegion mr);
   void set_space(CompactibleFreeListSpace* space) { _space = space; }
   size_t num_dirty_cards() { return _num_dirty_cards; }
+  // Forget how far up the space has been scanned, so that a region
+  // below the previous ones can be scanned next.
+  void reset_previous() { _scan_cl.set_previous(NULL); }
 };
 
 // This closure is used in the non-product build to check
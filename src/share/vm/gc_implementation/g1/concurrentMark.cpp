@@ -2384,7 +2384,7 @@ public:
     _workers(workers), _active_workers(n_workers) { }
 
   // Executes the given task using concurrent marking worker threads.
-  virtual void execute(ProcessTask& task);
+  virtual void execute(ProcessTask& task, uint ergo_workers);
   virtual void execute(EnqueueTask& task);
 };
 
@@ -2416,7 +2416,7 @@ public:
   }
 };
 
-void G1CMRefProcTaskExecutor::execute(ProcessTask& proc_task) {
+void G1CMRefProcTaskExecutor::execute(ProcessTask& proc_task, uint ergo_workers) {
   assert(_workers != NULL, "Need parallel worker threads.");
   assert(_g1h->ref_processor_cm()->processing_is_mt(), "processing is not MT");
 
@@ -2425,7 +2425,10 @@ void G1CMRefProcTaskExecutor::execute(ProcessTask& proc_task) {
   // We need to reset the concurrency level before each
   // proxy task execution, so that the termination protocol
   // and overflow handling in CMTask::do_marking_step() knows
-  // how many workers to wait for.
+  // how many workers to wait for.  All active workers take part,
+  // even if fewer than that have references (ergo_workers), since
+  // the marking tasks share the global mark stack and overflow
+  // handling.
   _cm->set_concurrency(_active_workers);
   _g1h->set_par_threads(_active_workers);
   _workers->run_task(&proc_task_proxy);
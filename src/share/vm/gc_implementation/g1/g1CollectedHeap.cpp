@@ -2611,6 +2611,28 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+uint G1CollectedHeap::run_par_object_iterate_task(AbstractGangTask* task) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (!G1CollectedHeap::use_parallel_gc_threads()) {
+    return 0;
+  }
+  assert(check_heap_region_claim_values(HeapRegion::InitialClaimValue),
+         "sanity check");
+  uint n_workers = workers()->active_workers();
+  set_par_threads(n_workers);
+  workers()->run_task(task);
+  set_par_threads(0);
+  reset_heap_region_claim_values();
+  return n_workers;
+}
+
+void G1CollectedHeap::par_object_iterate(ObjectClosure* cl, uint worker_id) {
+  IterateObjectClosureRegionClosure blk(cl);
+  heap_region_par_iterate_chunked(&blk, worker_id,
+                                  workers()->active_workers(),
+                                  HeapRegion::ParObjectIterClaimValue);
+}
+
 // Calls a SpaceClosure on a HeapRegion.
 
 class SpaceClosureRegionClosure: public HeapRegionClosure {
@@ -5438,7 +5460,7 @@ public:
   }
 
   // Executes the given task using concurrent marking worker threads.
-  virtual void execute(ProcessTask& task);
+  virtual void execute(ProcessTask& task, uint ergo_workers);
   virtual void execute(EnqueueTask& task);
 };
 
@@ -5450,20 +5472,27 @@ class G1STWRefProcTaskProxy: public AbstractGangTask {
   G1CollectedHeap* _g1h;
   RefToScanQueueSet *_task_queues;
   ParallelTaskTerminator* _terminator;
+  uint             _ergo_workers;
 
 public:
   G1STWRefProcTaskProxy(ProcessTask& proc_task,
                      G1CollectedHeap* g1h,
                      RefToScanQueueSet *task_queues,
-                     ParallelTaskTerminator* terminator) :
+                     ParallelTaskTerminator* terminator,
+                     uint ergo_workers) :
     AbstractGangTask("Process reference objects in parallel"),
     _proc_task(proc_task),
     _g1h(g1h),
     _task_queues(task_queues),
-    _terminator(terminator)
+    _terminator(terminator),
+    _ergo_workers(ergo_workers)
   {}
 
   virtual void work(uint worker_id) {
+    if (worker_id >= _ergo_workers) {
+      // The reference lists of this worker are empty.
+      return;
+    }
     // The reference processing task executed by a single worker.
     ResourceMark rm;
     HandleMark   hm;
@@ -5505,11 +5534,12 @@ public:
 // Driver routine for parallel reference processing.
 // Creates an instance of the ref processing gang
 // task and has the worker threads execute it.
-void G1STWRefProcTaskExecutor::execute(ProcessTask& proc_task) {
+void G1STWRefProcTaskExecutor::execute(ProcessTask& proc_task, uint ergo_workers) {
   assert(_workers != NULL, "Need parallel worker threads.");
 
-  ParallelTaskTerminator terminator(_active_workers, _queues);
-  G1STWRefProcTaskProxy proc_task_proxy(proc_task, _g1h, _queues, &terminator);
+  ParallelTaskTerminator terminator(MIN2((uint)_active_workers, ergo_workers), _queues);
+  G1STWRefProcTaskProxy proc_task_proxy(proc_task, _g1h, _queues, &terminator,
+                                        ergo_workers);
 
   _g1h->set_par_threads(_active_workers);
   _workers->run_task(&proc_task_proxy);
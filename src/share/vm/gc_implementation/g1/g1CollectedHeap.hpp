@@ -1281,6 +1281,9 @@ public:
     object_iterate(cl);
   }
 
+  virtual uint run_par_object_iterate_task(AbstractGangTask* task);
+  virtual void par_object_iterate(ObjectClosure* cl, uint worker_id);
+
   // Iterate over all spaces in use in the heap, in ascending address order.
   virtual void space_iterate(SpaceClosure* cl);
 
@@ -30,6 +30,7 @@
 #include "gc_implementation/g1/g1CollectorPolicy.hpp"
 #include "gc_implementation/g1/g1ErgoVerbose.hpp"
 #include "gc_implementation/g1/g1GCPhaseTimes.hpp"
+#include "gc_implementation/g1/g1IHOPControl.hpp"
 #include "gc_implementation/g1/g1Log.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
 #include "gc_implementation/shared/gcPolicyCounters.hpp"
@@ -288,6 +289,10 @@ G1CollectorPolicy::G1CollectorPolicy() :
   }
   _sigma = (double) confidence_perc / 100.0;
 
+  _ihop_control = create_ihop_control();
+  _old_gen_bytes_at_last_gc = 0;
+  _initial_mark_end_sec = 0.0;
+
   // start conservatively (around 50ms is about right)
   _concurrent_mark_remark_times_ms->add(0.05);
   _concurrent_mark_cleanup_times_ms->add(0.20);
@@ -454,11 +459,26 @@ void G1CollectorPolicy::init() {
   _free_regions_at_end_of_collection = _g1->num_free_regions();
   update_young_list_target_length();
 
+  _ihop_control->update_target_occupancy(_g1->capacity());
+  _old_gen_bytes_at_last_gc = _g1->non_young_capacity_bytes();
+
   // We may immediately start allocating regions and placing them on the
   // collection set list. Initialize the per-collection set info
   start_incremental_cset_building();
 }
 
+G1IHOPControl* G1CollectorPolicy::create_ihop_control() const {
+  if (G1UseAdaptiveIHOP) {
+    return new G1AdaptiveIHOPControl(InitiatingHeapOccupancyPercent,
+                                     0 /* target occupancy, set in init() */,
+                                     _sigma,
+                                     G1ReservePercent,
+                                     G1HeapWastePercent);
+  } else {
+    return new G1StaticIHOPControl(InitiatingHeapOccupancyPercent, 0);
+  }
+}
+
 // Create the jstat counters for the policy.
 void G1CollectorPolicy::initialize_gc_policy_counters() {
   _gc_policy_counters = new GCPolicyCounters("GarbageFirst", 1, 3);
@@ -503,6 +523,10 @@ void G1CollectorPolicy::record_new_heap_size(uint new_number_of_regions) {
   _reserve_regions = (uint) ceil(reserve_regions_d);
 
   _young_gen_sizer->heap_size_changed(new_number_of_regions);
+
+  // The IHOP threshold is a fraction of the current heap capacity; keep
+  // it in step with expansions outside of pauses too.
+  _ihop_control->update_target_occupancy((size_t)new_number_of_regions * HeapRegion::GrainBytes);
 }
 
 uint G1CollectorPolicy::calculate_young_list_desired_min_length(
@@ -828,6 +852,11 @@ void G1CollectorPolicy::record_full_collection_end() {
   // Reset survivors SurvRateGroup.
   _survivor_surv_rate_group->reset();
   update_young_list_target_length();
+
+  // The full GC compacted the old gen, start measuring old gen
+  // allocation from the new occupancy.
+  _ihop_control->update_target_occupancy(_g1->capacity());
+  _old_gen_bytes_at_last_gc = _g1->non_young_capacity_bytes();
   _collectionSetChooser->clear();
 }
 
@@ -872,6 +901,7 @@ void G1CollectorPolicy::record_concurrent_mark_init_end(double
   assert(!initiate_conc_mark_if_possible(), "we should have cleared it by now");
   clear_during_initial_mark_pause();
   _cur_mark_stop_world_time_ms = mark_init_elapsed_time_ms;
+  _initial_mark_end_sec = os::elapsedTime();
 }
 
 void G1CollectorPolicy::record_concurrent_mark_remark_start() {
@@ -910,8 +940,8 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
     return false;
   }
 
-  size_t marking_initiating_used_threshold =
-    (_g1->capacity() / 100) * InitiatingHeapOccupancyPercent;
+  size_t marking_initiating_used_threshold = _ihop_control->get_conc_mark_start_threshold();
+  double marking_initiating_used_perc = (double) marking_initiating_used_threshold / _g1->capacity() * 100.0;
   size_t cur_used_bytes = _g1->non_young_capacity_bytes();
   size_t alloc_byte_size = alloc_word_size * HeapWordSize;
 
@@ -927,7 +957,7 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
         cur_used_bytes,
         alloc_byte_size,
         marking_initiating_used_threshold,
-        (double) InitiatingHeapOccupancyPercent,
+        marking_initiating_used_perc,
         source);
       return true;
     } else {
@@ -941,7 +971,7 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
         cur_used_bytes,
         alloc_byte_size,
         marking_initiating_used_threshold,
-        (double) InitiatingHeapOccupancyPercent,
+        marking_initiating_used_perc,
         source);
     }
   }
@@ -952,6 +982,31 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
 // Anything below that is considered to be zero
 #define MIN_TIMER_GRANULARITY 0.0000001
 
+void G1CollectorPolicy::update_ihop_prediction(bool this_gc_was_young_only) {
+  size_t old_gen_bytes = _g1->non_young_capacity_bytes();
+  _ihop_control->update_target_occupancy(_g1->capacity());
+
+  // Only sample young-only pauses. Mixed pauses reclaim old regions,
+  // which hides the amount allocated into the old gen.
+  if (this_gc_was_young_only) {
+    double mutator_time_s =
+      phase_times()->cur_collection_start_sec() - _prev_collection_pause_end_ms / 1000.0;
+    if (mutator_time_s > MIN_TIMER_GRANULARITY) {
+      // The growth of the non-young occupancy since the previous pause
+      // covers both humongous allocations by the mutator and promotions
+      // during this pause.
+      size_t old_gen_alloc_bytes =
+        old_gen_bytes > _old_gen_bytes_at_last_gc ? old_gen_bytes - _old_gen_bytes_at_last_gc : 0;
+      _ihop_control->update_allocation_info(mutator_time_s,
+                                            old_gen_alloc_bytes,
+                                            (size_t) _young_list_target_length * HeapRegion::GrainBytes);
+      _ihop_control->print();
+    }
+  }
+
+  _old_gen_bytes_at_last_gc = old_gen_bytes;
+}
+
 void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, EvacuationInfo& evacuation_info) {
   double end_time_sec = os::elapsedTime();
   assert(_cur_collection_pause_used_regions_at_start >= cset_region_length(),
@@ -971,6 +1026,10 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
   }
 #endif // PRODUCT
 
+  // Update the IHOP prediction before deciding whether to start a
+  // concurrent cycle below.
+  update_ihop_prediction(update_stats && _last_gc_was_young);
+
   last_pause_included_initial_mark = during_initial_mark_pause();
   if (last_pause_included_initial_mark) {
     record_concurrent_mark_init_end(0.0);
@@ -1051,6 +1110,12 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
     // This is supposed to to be the "last young GC" before we start
     // doing mixed GCs. Here we decide whether to start mixed GCs or not.
 
+    // Marking has completed and the old gen can be reclaimed from now
+    // on. The wall clock time since the initial-mark pause, including
+    // the pauses in between, is a conservative estimate of how long
+    // the old gen has to absorb allocations after a cycle is started.
+    _ihop_control->update_marking_length(end_time_sec - _initial_mark_end_sec);
+
     if (!last_pause_included_initial_mark) {
       if (next_gc_should_be_mixed("start mixed GCs",
                                   "do not start mixed GCs")) {
@@ -1655,6 +1720,10 @@ G1CollectorPolicy::record_concurrent_mark_cleanup_end(int no_of_gc_threads) {
   _cur_mark_stop_world_time_ms += elapsed_time_ms;
   _prev_collection_pause_end_ms += elapsed_time_ms;
   _mmu_tracker->add_pause(_mark_cleanup_start_sec, end_sec, true);
+
+  // Cleanup freed completely empty old regions. Restart measuring old
+  // gen allocation so the drop in occupancy does not hide allocations.
+  _old_gen_bytes_at_last_gc = _g1->non_young_capacity_bytes();
 }
 
 // Add the heap region at the head of the non-incremental collection set
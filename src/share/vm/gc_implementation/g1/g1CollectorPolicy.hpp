@@ -38,6 +38,7 @@
 class HeapRegion;
 class CollectionSetChooser;
 class G1GCPhaseTimes;
+class G1IHOPControl;
 
 // TraceGen0Time collects data on _both_ young and mixed evacuation pauses
 // (the latter may contain non-young regions - i.e. regions that are
@@ -178,6 +179,23 @@ private:
 
   G1MMUTracker* _mmu_tracker;
 
+  // Decides the non-young occupancy at which a concurrent cycle is started.
+  G1IHOPControl* _ihop_control;
+
+  // Non-young occupancy at the end of the last pause, used to measure
+  // how much was allocated in the old gen (promotions and humongous
+  // allocations) between pauses.
+  size_t _old_gen_bytes_at_last_gc;
+
+  // End time of the last initial-mark pause, used to measure how long
+  // it takes from starting a concurrent cycle until mixed GCs can start.
+  double _initial_mark_end_sec;
+
+  G1IHOPControl* create_ihop_control() const;
+  // Feed the IHOP control with the old gen allocation and the marking
+  // length observed by the pause that just ended.
+  void update_ihop_prediction(bool this_gc_was_young_only);
+
   void initialize_alignments();
   void initialize_flags();
 
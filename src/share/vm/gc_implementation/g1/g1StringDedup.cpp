@@ -163,13 +163,17 @@ void G1StringDedup::unlink_or_oops_do(BoolObjectClosure* is_alive,
 
 void G1StringDedup::threads_do(ThreadClosure* tc) {
   assert(is_enabled(), "String deduplication not enabled");
-  tc->do_thread(G1StringDedupThread::thread());
+  for (uint i = 0; i < G1StringDedupThread::nthreads(); i++) {
+    tc->do_thread(G1StringDedupThread::thread(i));
+  }
 }
 
 void G1StringDedup::print_worker_threads_on(outputStream* st) {
   assert(is_enabled(), "String deduplication not enabled");
-  G1StringDedupThread::thread()->print_on(st);
-  st->cr();
+  for (uint i = 0; i < G1StringDedupThread::nthreads(); i++) {
+    G1StringDedupThread::thread(i)->print_on(st);
+    st->cr();
+  }
 }
 
 void G1StringDedup::verify() {
@@ -114,7 +114,7 @@ public:
   // Initialize string deduplication.
   static void initialize();
 
-  // Stop the deduplication thread.
+  // Stop the deduplication threads.
   static void stop();
 
   // Immediately deduplicates the given String object, bypassing the
@@ -34,15 +34,20 @@ const size_t        G1StringDedupQueue::_max_size = 1000000; // Max number of el
 const size_t        G1StringDedupQueue::_max_cache_size = 0; // Max cache size per queue
 
 G1StringDedupQueue::G1StringDedupQueue() :
-  _cursor(0),
   _cancel(false),
-  _empty(true),
   _dropped(0) {
   _nqueues = MAX2(ParallelGCThreads, (size_t)1);
   _queues = NEW_C_HEAP_ARRAY(G1StringDedupWorkerQueue, _nqueues, mtGC);
   for (size_t i = 0; i < _nqueues; i++) {
     new (_queues + i) G1StringDedupWorkerQueue(G1StringDedupWorkerQueue::default_segment_size(), _max_cache_size, _max_size);
   }
+
+  // Each deduplication thread needs at least one queue of its own
+  _nconsumers = (uint)MIN2((size_t)StringDeduplicationThreads, _nqueues);
+  _consumers = NEW_C_HEAP_ARRAY(G1StringDedupConsumer, _nconsumers, mtGC);
+  for (uint i = 0; i < _nconsumers; i++) {
+    new (_consumers + i) G1StringDedupConsumer();
+  }
 }
 
 G1StringDedupQueue::~G1StringDedupQueue() {
@@ -54,9 +59,15 @@ void G1StringDedupQueue::create() {
   _queue = new G1StringDedupQueue();
 }
 
-void G1StringDedupQueue::wait() {
+uint G1StringDedupQueue::nconsumers() {
+  return _queue->_nconsumers;
+}
+
+void G1StringDedupQueue::wait(uint consumer) {
+  assert(consumer < _queue->_nconsumers, "Invalid consumer");
+  G1StringDedupConsumer* c = &_queue->_consumers[consumer];
   MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
-  while (_queue->_empty && !_queue->_cancel) {
+  while (c->_empty && !_queue->_cancel) {
     ml.wait(Mutex::_no_safepoint_check_flag);
   }
 }
@@ -64,7 +75,7 @@ void G1StringDedupQueue::wait() {
 void G1StringDedupQueue::cancel_wait() {
   MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
   _queue->_cancel = true;
-  ml.notify();
+  ml.notify_all();
 }
 
 void G1StringDedupQueue::push(uint worker_id, oop java_string) {
@@ -75,12 +86,14 @@ void G1StringDedupQueue::push(uint worker_id, oop java_string) {
   G1StringDedupWorkerQueue& worker_queue = _queue->_queues[worker_id];
   if (!worker_queue.is_full()) {
     worker_queue.push(java_string);
-    if (_queue->_empty) {
+    G1StringDedupConsumer* c = &_queue->_consumers[worker_id % _queue->_nconsumers];
+    if (c->_empty) {
       MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
-      if (_queue->_empty) {
-        // Mark non-empty and notify waiter
-        _queue->_empty = false;
-        ml.notify();
+      if (c->_empty) {
+        // Mark non-empty and notify waiter. All deduplication
+        // threads wait on the same monitor, so wake them all.
+        c->_empty = false;
+        ml.notify_all();
       }
     }
   } else {
@@ -89,14 +102,18 @@ void G1StringDedupQueue::push(uint worker_id, oop java_string) {
   }
 }
 
-oop G1StringDedupQueue::pop() {
+oop G1StringDedupQueue::pop(uint consumer) {
   assert(!SafepointSynchronize::is_at_safepoint(), "Must not be at safepoint");
+  assert(consumer < _queue->_nconsumers, "Invalid consumer");
   No_Safepoint_Verifier nsv;
 
-  // Try all queues before giving up
-  for (size_t tries = 0; tries < _queue->_nqueues; tries++) {
+  G1StringDedupConsumer* c = &_queue->_consumers[consumer];
+  const size_t nowned = (_queue->_nqueues - consumer + _queue->_nconsumers - 1) / _queue->_nconsumers;
+
+  // Try all queues owned by this consumer before giving up
+  for (size_t tries = 0; tries < nowned; tries++) {
     // The cursor indicates where we left of last time
-    G1StringDedupWorkerQueue* queue = &_queue->_queues[_queue->_cursor];
+    G1StringDedupWorkerQueue* queue = &_queue->_queues[consumer + c->_cursor * _queue->_nconsumers];
     while (!queue->is_empty()) {
       oop obj = queue->pop();
       // The oop we pop can be NULL if it was marked
@@ -107,11 +124,11 @@ oop G1StringDedupQueue::pop() {
     }
 
     // Try next queue
-    _queue->_cursor = (_queue->_cursor + 1) % _queue->_nqueues;
+    c->_cursor = (c->_cursor + 1) % nowned;
   }
 
   // Mark empty
-  _queue->_empty = true;
+  c->_empty = true;
 
   return NULL;
 }
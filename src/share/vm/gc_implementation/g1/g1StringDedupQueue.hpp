@@ -47,26 +47,37 @@ class G1StringDedupUnlinkOrOopsDoClosure;
 // thread.
 //
 // Pushing to the queue is thread safe (this relies on each thread using a unique worker
-// id), but only allowed during a safepoint. Popping from the queue is NOT thread safe
-// and can only be done by the deduplication thread outside a safepoint.
+// id), but only allowed during a safepoint. Popping from the queue can only be done by
+// the deduplication threads outside a safepoint. The GC worker queues are divided
+// between the deduplication threads (queue i belongs to deduplication thread i modulo
+// the number of deduplication threads), so a queue is only ever popped by one thread.
 //
-// The StringDedupQueue_lock is only used for blocking and waking up the deduplication
-// thread in case the queue is empty or becomes non-empty, respectively. This lock does
+// The StringDedupQueue_lock is only used for blocking and waking up a deduplication
+// thread in case its queues are empty or become non-empty, respectively. This lock does
 // not otherwise protect the queue content.
 //
 class G1StringDedupQueue : public CHeapObj<mtGC> {
 private:
   typedef Stack<oop, mtGC> G1StringDedupWorkerQueue;
 
+  // Per deduplication thread state.
+  class G1StringDedupConsumer VALUE_OBJ_CLASS_SPEC {
+  public:
+    size_t                   _cursor;
+    volatile bool            _empty;
+
+    G1StringDedupConsumer() : _cursor(0), _empty(true) { }
+  };
+
   static G1StringDedupQueue* _queue;
   static const size_t        _max_size;
   static const size_t        _max_cache_size;
 
   G1StringDedupWorkerQueue*  _queues;
   size_t                     _nqueues;
-  size_t                     _cursor;
+  G1StringDedupConsumer*     _consumers;
+  uint                       _nconsumers;
   bool                       _cancel;
-  volatile bool              _empty;
 
   // Statistics counter, only used for logging.
   uintx                      _dropped;
@@ -79,8 +90,12 @@ private:
 public:
   static void create();
 
-  // Blocks and waits for the queue to become non-empty.
-  static void wait();
+  // Returns the number of deduplication threads consuming from the queue.
+  static uint nconsumers();
+
+  // Blocks and waits for the queues of the given deduplication thread
+  // to become non-empty.
+  static void wait(uint consumer);
 
   // Wakes up any thread blocked waiting for the queue to become non-empty.
   static void cancel_wait();
@@ -88,9 +103,9 @@ public:
   // Pushes a deduplication candidate onto a specific GC worker queue.
   static void push(uint worker_id, oop java_string);
 
-  // Pops a deduplication candidate from any queue, returns NULL if
-  // all queues are empty.
-  static oop pop();
+  // Pops a deduplication candidate from any queue belonging to the given
+  // deduplication thread, returns NULL if all those queues are empty.
+  static oop pop(uint consumer);
 
   static void unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* cl);
 
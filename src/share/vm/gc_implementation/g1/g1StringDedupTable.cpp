@@ -86,8 +86,7 @@ public:
 // later reuse or free the underlying memory for these entries.
 //
 // The cache allows for single-threaded allocations and multi-threaded frees.
-// Allocations are synchronized by StringDedupTable_lock as part of a table
-// modification.
+// Allocations are synchronized by StringDedupTable_lock.
 //
 class G1StringDedupEntryCache : public CHeapObj<mtGC> {
 private:
@@ -115,8 +114,8 @@ public:
   // Returns current number of entries in the cache.
   size_t size();
 
-  // Deletes overflowed entries.
-  void delete_overflowed();
+  // Deletes overflowed entries in the lists belonging to the given worker.
+  void delete_overflowed(uint worker_id, uint nworkers);
 };
 
 G1StringDedupEntryCache::G1StringDedupEntryCache(size_t max_size) :
@@ -169,11 +168,11 @@ size_t G1StringDedupEntryCache::size() {
   return size;
 }
 
-void G1StringDedupEntryCache::delete_overflowed() {
+void G1StringDedupEntryCache::delete_overflowed(uint worker_id, uint nworkers) {
   double start = os::elapsedTime();
   uintx count = 0;
 
-  for (size_t i = 0; i < _nlists; i++) {
+  for (size_t i = worker_id; i < _nlists; i += nworkers) {
     G1StringDedupEntry* entry;
 
     {
@@ -200,10 +199,15 @@ void G1StringDedupEntryCache::delete_overflowed() {
 }
 
 G1StringDedupTable*      G1StringDedupTable::_table = NULL;
+G1StringDedupTable*      G1StringDedupTable::_resized_table = NULL;
+size_t                   G1StringDedupTable::_resize_cursor = 0;
+Mutex**                  G1StringDedupTable::_stripe_locks = NULL;
 G1StringDedupEntryCache* G1StringDedupTable::_entry_cache = NULL;
 
 const size_t             G1StringDedupTable::_min_size = (1 << 10);   // 1024
 const size_t             G1StringDedupTable::_max_size = (1 << 24);   // 16777216
+const size_t             G1StringDedupTable::_nstripes = (1 << 6);    // 64, must not exceed _min_size
+const size_t             G1StringDedupTable::_resize_steps = 8;       // Spread a resize over 8 table scans
 const double             G1StringDedupTable::_grow_load_factor = 2.0; // Grow table at 200% load
 const double             G1StringDedupTable::_shrink_load_factor = _grow_load_factor / 3.0; // Shrink table at 67% load
 const double             G1StringDedupTable::_max_cache_factor = 0.1; // Cache a maximum of 10% of the table size
@@ -233,17 +237,30 @@ G1StringDedupTable::~G1StringDedupTable() {
 
 void G1StringDedupTable::create() {
   assert(_table == NULL, "One string deduplication table allowed");
+  assert(is_power_of_2(_nstripes) && _nstripes <= _min_size, "Invalid number of stripes");
+  _stripe_locks = NEW_C_HEAP_ARRAY(Mutex*, _nstripes, mtGC);
+  for (size_t i = 0; i < _nstripes; i++) {
+    _stripe_locks[i] = new Mutex(Mutex::leaf, "StringDedupTableStripe_lock", true);
+  }
   _entry_cache = new G1StringDedupEntryCache((size_t)(_min_size * _max_cache_factor));
   _table = new G1StringDedupTable(_min_size);
 }
 
 void G1StringDedupTable::add(typeArrayOop value, unsigned int hash, G1StringDedupEntry** list) {
-  G1StringDedupEntry* entry = _entry_cache->alloc();
+  G1StringDedupEntry* entry;
+  {
+    // The entry cache and the entry counters are shared by all stripes.
+    // The entry count is kept in the current table, also for entries
+    // added to a resized table that has not yet been installed.
+    MutexLockerEx ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
+    entry = _entry_cache->alloc();
+    _table->_entries++;
+    _entries_added++;
+  }
   entry->set_obj(value);
   entry->set_hash(hash);
   entry->set_next(*list);
   *list = entry;
-  _entries++;
 }
 
 void G1StringDedupTable::remove(G1StringDedupEntry** pentry, uint worker_id) {
@@ -303,9 +320,6 @@ typeArrayOop G1StringDedupTable::lookup_or_add_inner(typeArrayOop value, unsigne
   if (existing_value == NULL) {
     // Not found, add new entry
     add(value, hash, list);
-
-    // Update statistics
-    _entries_added++;
   }
 
   return existing_value;
@@ -383,6 +397,11 @@ void G1StringDedupTable::deduplicate(oop java_string, G1StringDedupStat& stat) {
 }
 
 G1StringDedupTable* G1StringDedupTable::prepare_resize() {
+  if (_resized_table != NULL) {
+    // Continue the resize in progress
+    return _resized_table;
+  }
+
   size_t size = _table->_size;
 
   // Check if the hashtable needs to be resized
@@ -420,11 +439,28 @@ G1StringDedupTable* G1StringDedupTable::prepare_resize() {
 
   // Allocate the new table. The new table will be populated by workers
   // calling unlink_or_oops_do() and finally installed by finish_resize().
-  return new G1StringDedupTable(size, _table->_hash_seed);
+  _resized_table = new G1StringDedupTable(size, _table->_hash_seed);
+  _resize_cursor = 0;
+  return _resized_table;
+}
+
+size_t G1StringDedupTable::resize_transfer_end() {
+  assert(_resized_table != NULL, "No resize in progress");
+  size_t table_half = _table->_size / 2;
+
+  // Both sizes are powers of two, so the step is a multiple of the partition size
+  size_t step = MAX2(table_half / _resize_steps, _table->partition_size());
+  return MIN2(table_half, _resize_cursor + step);
 }
 
 void G1StringDedupTable::finish_resize(G1StringDedupTable* resized_table) {
-  assert(resized_table != NULL, "Invalid table");
+  assert(resized_table != NULL && resized_table == _resized_table, "Invalid table");
+
+  _resize_cursor = resize_transfer_end();
+  if (_resize_cursor < _table->_size / 2) {
+    // More partitions left to transfer
+    return;
+  }
 
   resized_table->_entries = _table->_entries;
 
@@ -433,6 +469,8 @@ void G1StringDedupTable::finish_resize(G1StringDedupTable* resized_table) {
 
   // Install new table
   _table = resized_table;
+  _resized_table = NULL;
+  _resize_cursor = 0;
 }
 
 void G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* cl, uint worker_id) {
@@ -447,12 +485,22 @@ void G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* c
   // other partition is always the sibling partition in the second half of the table.
   // For example, if the table is divided into 8 partitions, the sibling of partition 0
   // is partition 4, the sibling of partition 1 is partition 5, etc.
+  //
+  // The same pairing drives an incremental resize. The entries of a partition and its
+  // sibling can only hash to partitions in the resized table with the same offset into
+  // each half of the current table, so those are also exclusive to the claiming worker.
   size_t table_half = _table->_size / 2;
 
   // Let each partition be one page worth of buckets
-  size_t partition_size = MIN2(table_half, os::vm_page_size() / sizeof(G1StringDedupEntry*));
+  size_t partition_size = _table->partition_size();
   assert(table_half % partition_size == 0, "Invalid partition size");
 
+  // Partitions below transfer_begin were transferred to the resized table during
+  // earlier scans, partitions in [transfer_begin, transfer_end) are transferred
+  // during this scan, if the closure allows it.
+  size_t transfer_begin = _resize_cursor;
+  size_t transfer_end = cl->is_resizing() ? resize_transfer_end() : transfer_begin;
+
   // Number of entries removed during the scan
   uintx removed = 0;
 
@@ -465,9 +513,17 @@ void G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* c
       break;
     }
 
-    // Scan the partition followed by the sibling partition in the second half of the table
-    removed += unlink_or_oops_do(cl, partition_begin, partition_end, worker_id);
-    removed += unlink_or_oops_do(cl, table_half + partition_begin, table_half + partition_end, worker_id);
+    if (partition_begin < transfer_begin) {
+      // Already transferred, scan the matching partitions in the resized table instead
+      for (size_t offset = 0; offset < _resized_table->_size; offset += table_half) {
+        removed += unlink_or_oops_do(cl, _resized_table, NULL, offset + partition_begin, offset + partition_end, worker_id);
+      }
+    } else {
+      // Scan the partition followed by the sibling partition in the second half of the table
+      G1StringDedupTable* dest = (partition_begin < transfer_end) ? _resized_table : NULL;
+      removed += unlink_or_oops_do(cl, _table, dest, partition_begin, partition_end, worker_id);
+      removed += unlink_or_oops_do(cl, _table, dest, table_half + partition_begin, table_half + partition_end, worker_id);
+    }
   }
 
   // Delayed update to avoid contention on the table lock
@@ -479,19 +535,21 @@ void G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* c
 }
 
 uintx G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* cl,
+                                            G1StringDedupTable* table,
+                                            G1StringDedupTable* dest,
                                             size_t partition_begin,
                                             size_t partition_end,
                                             uint worker_id) {
   uintx removed = 0;
   for (size_t bucket = partition_begin; bucket < partition_end; bucket++) {
-    G1StringDedupEntry** entry = _table->bucket(bucket);
+    G1StringDedupEntry** entry = table->bucket(bucket);
     while (*entry != NULL) {
       oop* p = (oop*)(*entry)->obj_addr();
       if (cl->is_alive(*p)) {
         cl->keep_alive(p);
-        if (cl->is_resizing()) {
+        if (dest != NULL) {
           // We are resizing the table, transfer entry to the new table
-          _table->transfer(entry, cl->resized_table());
+          table->transfer(entry, dest);
         } else {
           if (cl->is_rehashing()) {
             // We are rehashing the table, rehash the entry but keep it
@@ -509,7 +567,7 @@ uintx G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure*
         }
       } else {
         // Not alive, remove entry from table
-        _table->remove(entry, worker_id);
+        table->remove(entry, worker_id);
         removed++;
       }
     }
@@ -519,6 +577,7 @@ uintx G1StringDedupTable::unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure*
 }
 
 G1StringDedupTable* G1StringDedupTable::prepare_rehash() {
+  assert(_resized_table == NULL, "Can not rehash during resize");
   if (!_table->_rehash_needed && !StringDeduplicationRehashALot) {
     // Rehash not needed
     return NULL;
@@ -555,9 +614,23 @@ void G1StringDedupTable::finish_rehash(G1StringDedupTable* rehashed_table) {
 }
 
 void G1StringDedupTable::verify() {
-  for (size_t bucket = 0; bucket < _table->_size; bucket++) {
+  verify(_table);
+  if (_resized_table != NULL) {
+    verify(_resized_table);
+
+    // Verify that transferred buckets are empty
+    size_t table_half = _table->_size / 2;
+    for (size_t bucket = 0; bucket < _resize_cursor; bucket++) {
+      guarantee(*_table->bucket(bucket) == NULL, "Transferred bucket must be empty");
+      guarantee(*_table->bucket(table_half + bucket) == NULL, "Transferred bucket must be empty");
+    }
+  }
+}
+
+void G1StringDedupTable::verify(G1StringDedupTable* table) {
+  for (size_t bucket = 0; bucket < table->_size; bucket++) {
     // Verify entries
-    G1StringDedupEntry** entry = _table->bucket(bucket);
+    G1StringDedupEntry** entry = table->bucket(bucket);
     while (*entry != NULL) {
       typeArrayOop value = (*entry)->obj();
       guarantee(value != NULL, "Object must not be NULL");
@@ -566,7 +639,7 @@ void G1StringDedupTable::verify() {
       guarantee(value->is_typeArray(), "Object must be a typeArrayOop");
       unsigned int hash = hash_code(value);
       guarantee((*entry)->hash() == hash, "Table entry has inorrect hash");
-      guarantee(_table->hash_to_index(hash) == bucket, "Table entry has incorrect index");
+      guarantee(table->hash_to_index(hash) == bucket, "Table entry has incorrect index");
       entry = (*entry)->next_addr();
     }
 
@@ -574,7 +647,7 @@ void G1StringDedupTable::verify() {
     // We only need to compare entries in the same bucket. If the same oop or an
     // identical array has been inserted more than once into different/incorrect
     // buckets the verification step above will catch that.
-    G1StringDedupEntry** entry1 = _table->bucket(bucket);
+    G1StringDedupEntry** entry1 = table->bucket(bucket);
     while (*entry1 != NULL) {
       typeArrayOop value1 = (*entry1)->obj();
       G1StringDedupEntry** entry2 = (*entry1)->next_addr();
@@ -588,8 +661,8 @@ void G1StringDedupTable::verify() {
   }
 }
 
-void G1StringDedupTable::clean_entry_cache() {
-  _entry_cache->delete_overflowed();
+void G1StringDedupTable::clean_entry_cache(uint worker_id, uint nworkers) {
+  _entry_cache->delete_overflowed(worker_id, nworkers);
 }
 
 void G1StringDedupTable::print_statistics(outputStream* st) {
@@ -601,7 +674,8 @@ void G1StringDedupTable::print_statistics(outputStream* st) {
     "      [Resize Count: " UINTX_FORMAT ", Shrink Threshold: " UINTX_FORMAT "(" G1_STRDEDUP_PERCENT_FORMAT_NS "), Grow Threshold: " UINTX_FORMAT "(" G1_STRDEDUP_PERCENT_FORMAT_NS ")]\n"
     "      [Rehash Count: " UINTX_FORMAT ", Rehash Threshold: " UINTX_FORMAT ", Hash Seed: " UINT64_FORMAT "]\n"
     "      [Age Threshold: " UINTX_FORMAT "]",
-    G1_STRDEDUP_BYTES_PARAM(_table->_size * sizeof(G1StringDedupEntry*) + (_table->_entries + _entry_cache->size()) * sizeof(G1StringDedupEntry)),
+    G1_STRDEDUP_BYTES_PARAM((_table->_size + (_resized_table != NULL ? _resized_table->_size : 0)) * sizeof(G1StringDedupEntry*) +
+                            (_table->_entries + _entry_cache->size()) * sizeof(G1StringDedupEntry)),
     _table->_size, _min_size, _max_size,
     _table->_entries, (double)_table->_entries / (double)_table->_size * 100.0, _entry_cache->size(), _entries_added, _entries_removed,
     _resize_count, _table->_shrink_threshold, _shrink_load_factor * 100.0, _table->_grow_threshold, _grow_load_factor * 100.0,
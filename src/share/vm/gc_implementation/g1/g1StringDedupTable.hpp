@@ -91,14 +91,26 @@ public:
 // The table has hash buckets with chains for hash collision. If the average chain
 // length goes above or below given thresholds the table grows or shrinks accordingly.
 //
+// A resize is done incrementally. The resized table is allocated when the resize
+// starts and a range of partitions is transferred into it each time the table is
+// scanned by unlink_or_oops_do(), until the resized table holds all entries and is
+// installed as the current table. Until then, a hash bucket is looked up in the
+// resized table if its partition has already been transferred, and in the current
+// table otherwise.
+//
 // The table is also dynamically rehashed (using a new hash seed) if it becomes severely
 // unbalanced, i.e., a hash chain is significantly longer than average.
 //
-// All access to the table is protected by the StringDedupTable_lock, except under
-// safepoints in which case GC workers are allowed to access a table partitions they
-// have claimed without first acquiring the lock. Note however, that this applies only
-// the table partition (i.e. a range of elements in _buckets), not other parts of the
-// table such as the _entries field, statistics counters, etc.
+// Access to a hash bucket is protected by one of a fixed number of stripe locks,
+// selected by the low bits of the hash code, which allows several deduplication
+// threads to use the table concurrently. Since every table size is a multiple of
+// the number of stripes, the same stripe lock protects a hash code in both the
+// current and the resized table. The entry cache and the table counters are
+// protected by the StringDedupTable_lock. Under safepoints GC workers are allowed
+// to access a table partitions they have claimed without first acquiring any lock.
+// Note however, that this applies only the table partition (i.e. a range of elements
+// in _buckets), not other parts of the table such as the _entries field, statistics
+// counters, etc.
 //
 class G1StringDedupTable : public CHeapObj<mtGC> {
 private:
@@ -106,6 +118,15 @@ private:
   // the table is resizes or rehashed.
   static G1StringDedupTable*      _table;
 
+  // The table being populated by an incremental resize, or NULL.
+  // Partitions in the first half of _table below _resize_cursor,
+  // together with their siblings, have been transferred into it.
+  static G1StringDedupTable*      _resized_table;
+  static size_t                   _resize_cursor;
+
+  // Locks protecting the hash buckets, see hash_to_stripe().
+  static Mutex**                  _stripe_locks;
+
   // Cache for reuse and fast alloc/free of table entries.
   static G1StringDedupEntryCache* _entry_cache;
 
@@ -125,6 +146,8 @@ private:
   // Constants governing table resize/rehash/cache.
   static const size_t             _min_size;
   static const size_t             _max_size;
+  static const size_t             _nstripes;
+  static const size_t             _resize_steps;
   static const double             _grow_load_factor;
   static const double             _shrink_load_factor;
   static const uintx              _rehash_multiple;
@@ -150,6 +173,32 @@ private:
     return (size_t)hash & (_size - 1);
   }
 
+  // Returns the stripe lock index for the given hash code.
+  static size_t hash_to_stripe(unsigned int hash) {
+    return (size_t)hash & (_nstripes - 1);
+  }
+
+  // Returns the number of buckets in each table partition claimed
+  // by a worker during unlink_or_oops_do().
+  size_t partition_size() {
+    return MIN2(_size / 2, os::vm_page_size() / sizeof(G1StringDedupEntry*));
+  }
+
+  // Returns the table currently holding the hash bucket for the given
+  // hash code, which is the resized table if the bucket has already
+  // been transferred by an incremental resize.
+  static G1StringDedupTable* table_for(unsigned int hash) {
+    if (_resized_table != NULL &&
+        (_table->hash_to_index(hash) & (_table->_size / 2 - 1)) < _resize_cursor) {
+      return _resized_table;
+    }
+    return _table;
+  }
+
+  // Returns the end of the range of partitions to transfer during
+  // the next scan of an incremental resize.
+  static size_t resize_transfer_end();
+
   // Adds a new table entry to the given hash bucket.
   void add(typeArrayOop value, unsigned int hash, G1StringDedupEntry** list);
 
@@ -170,11 +219,11 @@ private:
 
   // Thread safe lookup or add of table entry
   static typeArrayOop lookup_or_add(typeArrayOop value, unsigned int hash) {
-    // Protect the table from concurrent access. Also note that this lock
-    // acts as a fence for _table, which could have been replaced by a new
-    // instance if the table was resized or rehashed.
-    MutexLockerEx ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
-    return _table->lookup_or_add_inner(value, hash);
+    // Protect the hash bucket from concurrent access. Also note that this
+    // lock acts as a fence for _table and _resized_table, which could have
+    // been replaced or advanced at a safepoint since the last lookup.
+    MutexLockerEx ml(_stripe_locks[hash_to_stripe(hash)], Mutex::_no_safepoint_check_flag);
+    return table_for(hash)->lookup_or_add_inner(value, hash);
   }
 
   // Returns true if the hashtable is currently using a Java compatible
@@ -189,11 +238,17 @@ private:
   // currently active hash function and hash seed.
   static unsigned int hash_code(typeArrayOop value);
 
+  // Scans a partition of the given table. Live entries are transferred
+  // to the dest table, unless dest is NULL.
   static uintx unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* cl,
+                                 G1StringDedupTable* table,
+                                 G1StringDedupTable* dest,
                                  size_t partition_begin,
                                  size_t partition_end,
                                  uint worker_id);
 
+  static void verify(G1StringDedupTable* table);
+
 public:
   static void create();
 
@@ -201,12 +256,15 @@ public:
   // character array to the deduplication hashtable.
   static void deduplicate(oop java_string, G1StringDedupStat& stat);
 
-  // If a table resize is needed, returns a newly allocated empty
-  // hashtable of the proper size.
+  // If a table resize is in progress, returns the table being populated.
+  // Otherwise, if a table resize is needed, starts an incremental resize
+  // and returns a newly allocated empty hashtable of the proper size.
   static G1StringDedupTable* prepare_resize();
 
-  // Installs a newly resized table as the currently active table
-  // and deletes the previously active table.
+  // Advances the incremental resize past the partitions transferred by
+  // the last scan. Once all partitions have been transferred, installs
+  // the resized table as the currently active table and deletes the
+  // previously active table.
   static void finish_resize(G1StringDedupTable* resized_table);
 
   // If a table rehash is needed, returns a newly allocated empty
@@ -219,7 +277,8 @@ public:
   static void finish_rehash(G1StringDedupTable* rehashed_table);
 
   // If the table entry cache has grown too large, delete overflowed entries.
-  static void clean_entry_cache();
+  // The cache lists are divided between the given number of workers.
+  static void clean_entry_cache(uint worker_id, uint nworkers);
 
   static void unlink_or_oops_do(G1StringDedupUnlinkOrOopsDoClosure* cl, uint worker_id);
 
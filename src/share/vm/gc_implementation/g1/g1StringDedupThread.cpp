@@ -28,12 +28,20 @@
 #include "gc_implementation/g1/g1StringDedupTable.hpp"
 #include "gc_implementation/g1/g1StringDedupThread.hpp"
 #include "gc_implementation/g1/g1StringDedupQueue.hpp"
-
-G1StringDedupThread* G1StringDedupThread::_thread = NULL;
-
-G1StringDedupThread::G1StringDedupThread() :
-  ConcurrentGCThread() {
-  set_name("String Deduplication Thread");
+#include "runtime/mutexLocker.hpp"
+
+G1StringDedupThread** G1StringDedupThread::_threads = NULL;
+uint                  G1StringDedupThread::_nthreads = 0;
+G1StringDedupStat     G1StringDedupThread::_total_stat;
+
+G1StringDedupThread::G1StringDedupThread(uint worker_id) :
+  ConcurrentGCThread(),
+  _worker_id(worker_id) {
+  if (_nthreads > 1) {
+    set_name("String Deduplication Thread#%u", worker_id);
+  } else {
+    set_name("String Deduplication Thread");
+  }
   create_and_start();
 }
 
@@ -43,14 +51,24 @@ G1StringDedupThread::~G1StringDedupThread() {
 
 void G1StringDedupThread::create() {
   assert(G1StringDedup::is_enabled(), "String deduplication not enabled");
-  assert(_thread == NULL, "One string deduplication thread allowed");
-  _thread = new G1StringDedupThread();
+  assert(_threads == NULL, "String deduplication threads already created");
+  _nthreads = G1StringDedupQueue::nconsumers();
+  _threads = NEW_C_HEAP_ARRAY(G1StringDedupThread*, _nthreads, mtGC);
+  for (uint i = 0; i < _nthreads; i++) {
+    _threads[i] = new G1StringDedupThread(i);
+  }
 }
 
-G1StringDedupThread* G1StringDedupThread::thread() {
+uint G1StringDedupThread::nthreads() {
   assert(G1StringDedup::is_enabled(), "String deduplication not enabled");
-  assert(_thread != NULL, "String deduplication thread not created");
-  return _thread;
+  return _nthreads;
+}
+
+G1StringDedupThread* G1StringDedupThread::thread(uint worker_id) {
+  assert(G1StringDedup::is_enabled(), "String deduplication not enabled");
+  assert(_threads != NULL, "String deduplication threads not created");
+  assert(worker_id < _nthreads, "Invalid worker id");
+  return _threads[worker_id];
 }
 
 void G1StringDedupThread::print_on(outputStream* st) const {
@@ -60,8 +78,6 @@ void G1StringDedupThread::print_on(outputStream* st) const {
 }
 
 void G1StringDedupThread::run() {
-  G1StringDedupStat total_stat;
-
   initialize_in_thread();
   wait_for_universe_init();
 
@@ -72,7 +88,7 @@ void G1StringDedupThread::run() {
     stat.mark_idle();
 
     // Wait for the queue to become non-empty
-    G1StringDedupQueue::wait();
+    G1StringDedupQueue::wait(_worker_id);
     if (_should_terminate) {
       break;
     }
@@ -85,7 +101,7 @@ void G1StringDedupThread::run() {
 
       // Process the queue
       for (;;) {
-        oop java_string = G1StringDedupQueue::pop();
+        oop java_string = G1StringDedupQueue::pop(_worker_id);
         if (java_string == NULL) {
           break;
         }
@@ -102,12 +118,16 @@ void G1StringDedupThread::run() {
 
       stat.mark_done();
 
-      // Print statistics
-      total_stat.add(stat);
-      print(gclog_or_tty, stat, total_stat);
+      // Print statistics. The totals are shared by all threads, so
+      // they are updated and printed as one under the lock.
+      {
+        MutexLockerEx ml(StringDedupStat_lock, Mutex::_no_safepoint_check_flag);
+        _total_stat.add(stat);
+        print(gclog_or_tty, stat, _total_stat);
+      }
     }
 
-    G1StringDedupTable::clean_entry_cache();
+    G1StringDedupTable::clean_entry_cache(_worker_id, _nthreads);
   }
 
   terminate();
@@ -116,15 +136,19 @@ void G1StringDedupThread::run() {
 void G1StringDedupThread::stop() {
   {
     MonitorLockerEx ml(Terminator_lock);
-    _thread->_should_terminate = true;
+    for (uint i = 0; i < _nthreads; i++) {
+      _threads[i]->_should_terminate = true;
+    }
   }
 
   G1StringDedupQueue::cancel_wait();
 
   {
     MonitorLockerEx ml(Terminator_lock);
-    while (!_thread->_has_terminated) {
-      ml.wait();
+    for (uint i = 0; i < _nthreads; i++) {
+      while (!_threads[i]->_has_terminated) {
+        ml.wait();
+      }
     }
   }
 }
@@ -36,11 +36,20 @@
 // concurrently with the Java application but participates in safepoints to allow
 // the GC to adjust and unlink oops from the deduplication queue and table.
 //
+// There can be several deduplication threads (StringDeduplicationThreads). Each
+// thread drains its own subset of the GC worker queues and they share the table.
+//
 class G1StringDedupThread: public ConcurrentGCThread {
 private:
-  static G1StringDedupThread* _thread;
+  static G1StringDedupThread** _threads;
+  static uint                  _nthreads;
+
+  // Statistics summed over all threads, protected by StringDedupStat_lock
+  static G1StringDedupStat     _total_stat;
+
+  uint _worker_id;
 
-  G1StringDedupThread();
+  G1StringDedupThread(uint worker_id);
   ~G1StringDedupThread();
 
   void print(outputStream* st, const G1StringDedupStat& last_stat, const G1StringDedupStat& total_stat);
@@ -49,7 +58,8 @@ public:
   static void create();
   static void stop();
 
-  static G1StringDedupThread* thread();
+  static uint nthreads();
+  static G1StringDedupThread* thread(uint worker_id);
 
   virtual void run();
   virtual void print_on(outputStream* st) const;
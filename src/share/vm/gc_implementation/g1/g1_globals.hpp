@@ -200,6 +200,17 @@
           "It determines the minimum reserve we should have in the heap "   \
           "to minimize the probability of promotion failure.")              \
                                                                             \
+  product(bool, G1UseAdaptiveIHOP, false,                                   \
+          "Adaptively adjust the initiating heap occupancy from the "       \
+          "initial value of InitiatingHeapOccupancyPercent. The goal is "   \
+          "to start concurrent marking just in time to finish before "      \
+          "the old generation runs out of space.")                          \
+                                                                            \
+  experimental(uintx, G1AdaptiveIHOPNumInitialSamples, 3,                  \
+          "How many completed marking cycles and allocation samples are "   \
+          "needed before the adaptive IHOP is used instead of "             \
+          "InitiatingHeapOccupancyPercent.")                                \
+                                                                            \
   diagnostic(bool, G1PrintHeapRegions, false,                               \
           "If set G1 will print information on which regions are being "    \
           "allocated and which are reclaimed.")                             \
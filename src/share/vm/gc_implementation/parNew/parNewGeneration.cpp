@@ -769,12 +769,13 @@ public:
   ParNewRefProcTaskProxy(ProcessTask& task, ParNewGeneration& gen,
                          Generation& next_gen,
                          HeapWord* young_old_boundary,
-                         ParScanThreadStateSet& state_set);
+                         ParScanThreadStateSet& state_set,
+                         uint ergo_workers);
 
 private:
   virtual void work(uint worker_id);
   virtual void set_for_termination(int active_workers) {
-    _state_set.terminator()->reset_for_reuse(active_workers);
+    _state_set.terminator()->reset_for_reuse(MIN2(active_workers, (int)_ergo_workers));
   }
 private:
   ParNewGeneration&      _gen;
@@ -782,24 +783,31 @@ private:
   Generation&            _next_gen;
   HeapWord*              _young_old_boundary;
   ParScanThreadStateSet& _state_set;
+  uint                   _ergo_workers;
 };
 
 ParNewRefProcTaskProxy::ParNewRefProcTaskProxy(
     ProcessTask& task, ParNewGeneration& gen,
     Generation& next_gen,
     HeapWord* young_old_boundary,
-    ParScanThreadStateSet& state_set)
+    ParScanThreadStateSet& state_set,
+    uint ergo_workers)
   : AbstractGangTask("ParNewGeneration parallel reference processing"),
     _gen(gen),
     _task(task),
     _next_gen(next_gen),
     _young_old_boundary(young_old_boundary),
-    _state_set(state_set)
+    _state_set(state_set),
+    _ergo_workers(ergo_workers)
 {
 }
 
 void ParNewRefProcTaskProxy::work(uint worker_id)
 {
+  if (worker_id >= _ergo_workers) {
+    // The reference lists of this worker are empty.
+    return;
+  }
   ResourceMark rm;
   HandleMark hm;
   ParScanThreadState& par_scan_state = _state_set.thread_state(worker_id);
@@ -826,16 +834,18 @@ public:
 };
 
 
-void ParNewRefProcTaskExecutor::execute(ProcessTask& task)
+void ParNewRefProcTaskExecutor::execute(ProcessTask& task, uint ergo_workers)
 {
   GenCollectedHeap* gch = GenCollectedHeap::heap();
   assert(gch->kind() == CollectedHeap::GenCollectedHeap,
          "not a generational heap");
   FlexibleWorkGang* workers = gch->workers();
   assert(workers != NULL, "Need parallel worker threads.");
-  _state_set.reset(workers->active_workers(), _generation.promotion_failed());
+  _state_set.reset(MIN2(workers->active_workers(), ergo_workers),
+                   _generation.promotion_failed());
   ParNewRefProcTaskProxy rp_task(task, _generation, *_generation.next_gen(),
-                                 _generation.reserved().end(), _state_set);
+                                 _generation.reserved().end(), _state_set,
+                                 ergo_workers);
   workers->run_task(&rp_task);
   _state_set.reset(0 /* bad value in debug if not reset */,
                    _generation.promotion_failed());
@@ -29,6 +29,7 @@
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.inline.hpp"
 
@@ -407,6 +408,17 @@ void GCTaskManager::initialize() {
   _noop_task = NoopGCTask::create_on_c_heap();
   _idle_inactive_task = WaitForBarrierGCTask::create_on_c_heap();
   _resource_flag = NEW_C_HEAP_ARRAY(bool, workers(), mtGC);
+  _stolen_flag = NEW_C_HEAP_ARRAY(bool, workers(), mtGC);
+  _stealable_tasks = 0;
+  _task_deques = NULL;
+  if (UseGCTaskStealing) {
+    _task_deques = new GCTaskDequeSet(workers());
+    for (uint d = 0; d < workers(); d += 1) {
+      GCTaskDeque* deque = new GCTaskDeque();
+      deque->initialize();
+      _task_deques->register_queue(d, deque);
+    }
+  }
   {
     // Set up worker threads.
     //     Distribute the workers among the available processors,
@@ -435,6 +447,7 @@ void GCTaskManager::initialize() {
   set_unblocked();
   for (uint w = 0; w < workers(); w += 1) {
     set_resource_flag(w, false);
+    set_stolen_flag(w, false);
   }
   reset_delivered_tasks();
   reset_completed_tasks();
@@ -465,6 +478,18 @@ GCTaskManager::~GCTaskManager() {
     FREE_C_HEAP_ARRAY(bool, _resource_flag, mtGC);
     _resource_flag = NULL;
   }
+  if (_stolen_flag != NULL) {
+    FREE_C_HEAP_ARRAY(bool, _stolen_flag, mtGC);
+    _stolen_flag = NULL;
+  }
+  if (task_deques() != NULL) {
+    assert(stealable_tasks() == 0, "still have stealable work");
+    for (uint d = 0; d < workers(); d += 1) {
+      delete task_deque(d);
+    }
+    delete _task_deques;
+    _task_deques = NULL;
+  }
   if (queue() != NULL) {
     GCTaskQueue* unsynchronized_queue = queue()->unsynchronized_queue();
     GCTaskQueue::destroy(unsynchronized_queue);
@@ -615,6 +640,9 @@ void GCTaskManager::add_list(GCTaskQueue* list) {
   if (TraceGCTaskManager) {
     tty->print_cr("GCTaskManager::add_list(%u)", list->length());
   }
+  if (UseGCTaskStealing) {
+    add_stealable_tasks(list);
+  }
   queue()->enqueue(list);
   // Notify with the lock held to avoid missed notifies.
   if (TraceGCTaskManager) {
@@ -631,64 +659,101 @@ void GCTaskManager::add_list(GCTaskQueue* list) {
 // compete to get tasks.  If a GC worker wakes up and there
 // is no work on the queue, it is given a noop_task to execute
 // and then loops to find more work.
+//  With UseGCTaskStealing an active GC worker first tries to
+// claim a stealable task, and only goes to the queue once all
+// the stealable tasks have been claimed.  Until then the queue
+// only hands out IdleGCTasks, to the inactive workers.
 
 GCTask* GCTaskManager::get_task(uint which) {
   GCTask* result = NULL;
-  // Grab the queue lock.
-  MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
-  // Wait while the queue is block or
-  // there is nothing to do, except maybe release resources.
-  while (is_blocked() ||
-         (queue()->is_empty() && !should_release_resources(which))) {
-    if (TraceGCTaskManager) {
-      tty->print_cr("GCTaskManager::get_task(%u)"
-                    "  blocked: %s"
-                    "  empty: %s"
-                    "  release: %s",
-                    which,
-                    is_blocked() ? "true" : "false",
-                    queue()->is_empty() ? "true" : "false",
-                    should_release_resources(which) ? "true" : "false");
-      tty->print_cr("    => (%s)->wait()",
-                    monitor()->name());
+  for (;;) {
+    if (may_steal(which)) {
+      result = steal_task(which);
+      if (result != NULL) {
+        return result;
+      }
     }
-    monitor()->wait(Mutex::_no_safepoint_check_flag, 0);
-  }
-  // We've reacquired the queue lock here.
-  // Figure out which condition caused us to exit the loop above.
-  if (!queue()->is_empty()) {
-    if (UseGCTaskAffinity) {
-      result = queue()->dequeue(which);
-    } else {
+    // Grab the queue lock.
+    MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
+    // Wait while the queue is block or
+    // there is nothing to do, except maybe release resources.
+    while (!has_task_for(which)) {
+      if (TraceGCTaskManager) {
+        tty->print_cr("GCTaskManager::get_task(%u)"
+                      "  blocked: %s"
+                      "  empty: %s"
+                      "  release: %s",
+                      which,
+                      is_blocked() ? "true" : "false",
+                      queue()->is_empty() ? "true" : "false",
+                      should_release_resources(which) ? "true" : "false");
+        tty->print_cr("    => (%s)->wait()",
+                      monitor()->name());
+      }
+      monitor()->wait(Mutex::_no_safepoint_check_flag, 0);
+    }
+    if (stealable_tasks() != 0) {
+      if (may_steal(which)) {
+        // Stealable tasks were added while we were waiting.
+        // Release monitor() and go claim one of those.
+        continue;
+      }
+      // An inactive worker takes the IdleGCTask at the head.
       result = queue()->dequeue();
+      assert(result->is_idle_task(), "only idle tasks go around stealable ones");
+    } else if (!queue()->is_empty()) {
+      if (UseGCTaskAffinity) {
+        result = queue()->dequeue(which);
+      } else {
+        result = queue()->dequeue();
+      }
+      if (result->is_barrier_task()) {
+        assert(which != sentinel_worker(),
+               "blocker shouldn't be bogus");
+        set_blocking_worker(which);
+      }
+    } else {
+      // The queue is empty, but we were woken up.
+      // Just hand back a Noop task,
+      // in case someone wanted us to release resources, or whatever.
+      result = noop_task();
+      increment_noop_tasks();
+    }
+    assert(result != NULL, "shouldn't have null task");
+    if (TraceGCTaskManager) {
+      tty->print_cr("GCTaskManager::get_task(%u) => " INTPTR_FORMAT " [%s]",
+                    which, result, GCTask::Kind::to_string(result->kind()));
+      tty->print_cr("     %s", result->name());
     }
-    if (result->is_barrier_task()) {
-      assert(which != sentinel_worker(),
-             "blocker shouldn't be bogus");
-      set_blocking_worker(which);
+    if (!result->is_idle_task()) {
+      increment_busy_workers();
+      increment_delivered_tasks();
     }
-  } else {
-    // The queue is empty, but we were woken up.
-    // Just hand back a Noop task,
-    // in case someone wanted us to release resources, or whatever.
-    result = noop_task();
-    increment_noop_tasks();
-  }
-  assert(result != NULL, "shouldn't have null task");
-  if (TraceGCTaskManager) {
-    tty->print_cr("GCTaskManager::get_task(%u) => " INTPTR_FORMAT " [%s]",
-                  which, result, GCTask::Kind::to_string(result->kind()));
-    tty->print_cr("     %s", result->name());
+    return result;
+    // Release monitor().
   }
-  if (!result->is_idle_task()) {
-    increment_busy_workers();
-    increment_delivered_tasks();
+}
+
+// Whether get_task has something for worker "which" to do.  While there
+// are stealable tasks, only the active workers may go for them and the
+// inactive ones may only take an IdleGCTask.
+bool GCTaskManager::has_task_for(uint which) {
+  assert(monitor()->owned_by_self(), "don't own the lock");
+  if (stealable_tasks() != 0) {
+    if (may_steal(which)) {
+      return true;
+    }
+    return !is_blocked() && !queue()->is_empty() && queue()->peek()->is_idle_task();
   }
-  return result;
-  // Release monitor().
+  return !is_blocked() &&
+         (!queue()->is_empty() || should_release_resources(which));
 }
 
 void GCTaskManager::note_completion(uint which) {
+  if (UseGCTaskStealing && stolen_flag(which)) {
+    note_stealable_completion(which);
+    return;
+  }
   MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
   if (TraceGCTaskManager) {
     tty->print_cr("GCTaskManager::note_completion(%u)", which);
@@ -702,7 +767,7 @@ void GCTaskManager::note_completion(uint which) {
   }
   increment_completed_tasks();
   uint active = decrement_busy_workers();
-  if ((active == 0) && (queue()->is_empty())) {
+  if ((active == 0) && (queue()->is_empty()) && (stealable_tasks() == 0)) {
     increment_emptied_queue();
     if (TraceGCTaskManager) {
       tty->print_cr("    GCTaskManager::note_completion(%u) done", which);
@@ -738,17 +803,18 @@ void GCTaskManager::note_completion(uint which) {
   // Release monitor().
 }
 
+// Workers running stealable tasks update the count of busy
+// workers without holding the lock.
+
 uint GCTaskManager::increment_busy_workers() {
-  assert(queue()->own_lock(), "don't own the lock");
-  _busy_workers += 1;
-  return _busy_workers;
+  assert(UseGCTaskStealing || queue()->own_lock(), "don't own the lock");
+  return (uint) Atomic::add(1, (volatile jint*) &_busy_workers);
 }
 
 uint GCTaskManager::decrement_busy_workers() {
-  assert(queue()->own_lock(), "don't own the lock");
+  assert(UseGCTaskStealing || queue()->own_lock(), "don't own the lock");
   assert(_busy_workers > 0, "About to make a mistake");
-  _busy_workers -= 1;
-  return _busy_workers;
+  return (uint) Atomic::add(-1, (volatile jint*) &_busy_workers);
 }
 
 void GCTaskManager::release_all_resources() {
@@ -810,6 +876,141 @@ void GCTaskManager::set_resource_flag(uint which, bool value) {
   _resource_flag[which] = value;
 }
 
+bool GCTaskManager::stolen_flag(uint which) {
+  assert(which < workers(), "index out of bounds");
+  return _stolen_flag[which];
+}
+
+void GCTaskManager::set_stolen_flag(uint which, bool value) {
+  assert(which < workers(), "index out of bounds");
+  _stolen_flag[which] = value;
+}
+
+GCTaskDeque* GCTaskManager::task_deque(uint which) {
+  assert(which < workers(), "index out of bounds");
+  assert(task_deques() != NULL, "not using work stealing");
+  return task_deques()->queue(which);
+}
+
+// Only the ordinary tasks at the head of the list are made stealable.
+// The rest of the list, starting at the first barrier, idle or noop
+// task, stays on the list to be enqueued on the GCTaskManager's queue
+// behind them.  If the queue already holds tasks other than idle tasks,
+// or a barrier task is running, nothing is made stealable so that the
+// tasks keep their order relative to the earlier ones.
+//
+// Each deque is only ever pushed on here, under the monitor, and tasks
+// are only taken from its global end, so it does not matter that the
+// VM thread rather than the owning GC thread does the pushing.
+
+void GCTaskManager::add_stealable_tasks(GCTaskQueue* list) {
+  assert(monitor()->owned_by_self(), "don't own the lock");
+  if (is_blocked() || !only_idle_tasks_queued()) {
+    return;
+  }
+  const uint active = MAX2(active_workers(), 1U);
+  uint next = 0;
+  uint added = 0;
+  while (!list->is_empty() && list->peek()->is_ordinary_task()) {
+    GCTask* task = list->peek();
+    uint which = next;
+    if (UseGCTaskAffinity && task->affinity() < workers()) {
+      which = task->affinity();
+    } else {
+      next = (next + 1) % active;
+    }
+    if (!task_deque(which)->push(task)) {
+      // The deque is full.  The rest go on the queue.
+      break;
+    }
+    list->dequeue();
+    added += 1;
+  }
+  if (added > 0) {
+    // Publish the tasks only after they have all been pushed.
+    Atomic::add((jint) added, (volatile jint*) &_stealable_tasks);
+  }
+  if (TraceGCTaskManager) {
+    tty->print_cr("GCTaskManager::add_stealable_tasks(%u)", added);
+  }
+}
+
+// IdleGCTasks queued for the inactive workers (UseDynamicNumberOfGCThreads)
+// need no ordering against other work, so they don't keep tasks from
+// being made stealable.
+bool GCTaskManager::only_idle_tasks_queued() const {
+  for (GCTask* t = queue()->peek(); t != NULL; t = t->newer()) {
+    if (!t->is_idle_task()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A GC thread first takes the tasks in its own deque and then steals
+// from the others.  Until all stealable tasks have been claimed it keeps
+// looking; the tasks it fails to find are in the process of being
+// claimed by other GC threads.
+
+GCTask* GCTaskManager::steal_task(uint which) {
+  int seed = 17;
+  uint attempts = 0;
+  GCTask* result = NULL;
+  while (stealable_tasks() > 0) {
+    if (task_deque(which)->pop_global(result) ||
+        task_deques()->steal(which, &seed, result)) {
+      // Count ourselves busy before the task stops being stealable,
+      // so that a barrier task handed out once the stealable tasks are
+      // gone waits for this one to complete.
+      increment_busy_workers();
+      Atomic::dec((volatile jint*) &_stealable_tasks);
+      Atomic::inc((volatile jint*) &_delivered_tasks);
+      set_stolen_flag(which, true);
+      if (TraceGCTaskManager) {
+        tty->print_cr("GCTaskManager::steal_task(%u) => " INTPTR_FORMAT " [%s]",
+                      which, result, result->name());
+      }
+      return result;
+    }
+    attempts += 1;
+    if (WorkStealingSpinToYieldRatio > 0 &&
+        attempts % WorkStealingSpinToYieldRatio != 0) {
+      SpinPause();
+    } else {
+      os::yield();
+    }
+  }
+  return NULL;
+}
+
+// The only ones interested in the completion of a stealable task are
+// a barrier task waiting to be the last busy worker and the
+// NotifyDoneClosure, so the lock is only taken when the number of
+// busy workers drops to one or zero.
+
+void GCTaskManager::note_stealable_completion(uint which) {
+  set_stolen_flag(which, false);
+  Atomic::inc((volatile jint*) &_completed_tasks);
+  uint active = decrement_busy_workers();
+  if (TraceGCTaskManager) {
+    tty->print_cr("GCTaskManager::note_stealable_completion(%u) busy: %u",
+                  which, active);
+  }
+  if (active <= 1) {
+    MutexLockerEx ml(monitor(), Mutex::_no_safepoint_check_flag);
+    if ((busy_workers() == 0) && (queue()->is_empty()) &&
+        (stealable_tasks() == 0)) {
+      increment_emptied_queue();
+      NotifyDoneClosure* ndc = notify_done_closure();
+      if (ndc != NULL) {
+        ndc->notify(this);
+      }
+    }
+    (void) monitor()->notify_all();
+    // Release monitor().
+  }
+}
+
 //
 // NoopGCTask
 //
@@ -27,6 +27,7 @@
 
 #include "runtime/mutex.hpp"
 #include "utilities/growableArray.hpp"
+#include "utilities/taskqueue.hpp"
 
 //
 // The GCTaskManager is a queue of GCTasks, and accessors
@@ -164,6 +165,10 @@ public:
   uint length() const {
     return _length;
   }
+  //     The task dequeue() would return, without removing it.
+  GCTask* peek() const {
+    return remove_end();
+  }
   // Methods.
   //     Enqueue one task.
   void enqueue(GCTask* task);
@@ -257,6 +262,10 @@ public:
     guarantee(own_lock(), "don't own the lock");
     return unsynchronized_queue()->dequeue();
   }
+  GCTask* peek() const {
+    guarantee(own_lock(), "don't own the lock");
+    return unsynchronized_queue()->peek();
+  }
   GCTask* dequeue(uint affinity) {
     guarantee(own_lock(), "don't own the lock");
     return unsynchronized_queue()->dequeue(affinity);
@@ -353,6 +362,33 @@ protected:
 //
 // For PSScavenge and ParCompactionManager the GC threads are
 // held in the GCTaskThread** _thread array in GCTaskManager.
+//
+// Work stealing (UseGCTaskStealing)
+//
+//  With many GC threads, handing out every task under the
+// GCTaskManager's monitor becomes a point of contention.  With
+// UseGCTaskStealing the ordinary tasks at the head of a list passed
+// to add_list() are instead distributed over per-worker deques
+// (round robin, or by affinity with UseGCTaskAffinity).  A worker
+// claims tasks from its own deque and, when that is empty, steals
+// from the deques of the other workers, without taking the monitor.
+// Both owner and thieves take tasks from the global end of a deque,
+// so the tasks in a deque run in the order in which they were added
+// and, as in the single queue case, the work stealing tasks at the
+// end of a list are claimed last.
+//  Barrier, idle and noop tasks, and everything after them in a list,
+// are still enqueued on the monitor protected queue.  That queue is
+// not served until every stealable task has been claimed, and tasks
+// are only made stealable when the queue is empty and no barrier is
+// running, so a BarrierGCTask still waits for all the work added
+// ahead of it.  Workers that find no task in any deque keep looking
+// while unclaimed stealable tasks remain, spinning and yielding in
+// the manner of ParallelTaskTerminator, and otherwise wait on the
+// monitor as before.
+
+// The deques holding stealable tasks, one per GC thread.
+typedef GenericTaskQueue<GCTask*, mtGC, 1024>  GCTaskDeque;
+typedef GenericTaskQueueSet<GCTaskDeque, mtGC> GCTaskDequeSet;
 
 
 class GCTaskManager : public CHeapObj<mtGC> {
@@ -371,7 +407,7 @@ private:
   SynchronizedGCTaskQueue*  _queue;             // Queue of tasks.
   GCTaskThread**            _thread;            // Array of worker threads.
   uint                      _active_workers;    // Number of active workers.
-  uint                      _busy_workers;      // Number of busy workers.
+  volatile uint             _busy_workers;      // Number of busy workers.
   uint                      _blocking_worker;   // The worker that's blocking.
   bool*                     _resource_flag;     // Array of flag per threads.
   uint                      _delivered_tasks;   // Count of delivered tasks.
@@ -382,6 +418,9 @@ private:
   uint                      _noop_tasks;        // Count of noop tasks.
   WaitForBarrierGCTask*     _idle_inactive_task;// Task for inactive workers
   volatile uint             _idle_workers;      // Number of idled workers
+  GCTaskDequeSet*           _task_deques;       // Deques of stealable tasks.
+  volatile uint             _stealable_tasks;   // Unclaimed stealable tasks.
+  bool*                     _stolen_flag;       // Array of flag per threads.
 public:
   // Factory create and destroy methods.
   static GCTaskManager* create(uint workers) {
@@ -402,6 +441,9 @@ public:
   volatile uint idle_workers() const {
     return _idle_workers;
   }
+  uint stealable_tasks() const {
+    return _stealable_tasks;
+  }
   //     Pun between Monitor* and Mutex*
   Monitor* monitor() const {
     return _monitor;
@@ -478,11 +520,32 @@ protected:
   NoopGCTask* noop_task() const {
     return _noop_task;
   }
+  GCTaskDequeSet* task_deques() const {
+    return _task_deques;
+  }
   //     Bounds-checking per-thread data accessors.
   GCTaskThread* thread(uint which);
   void set_thread(uint which, GCTaskThread* value);
   bool resource_flag(uint which);
   void set_resource_flag(uint which, bool value);
+  GCTaskDeque* task_deque(uint which);
+  bool stolen_flag(uint which);
+  void set_stolen_flag(uint which, bool value);
+  // Work stealing support.
+  //     Only the active workers steal.
+  bool may_steal(uint which) const {
+    return UseGCTaskStealing && which < active_workers();
+  }
+  //     Does the queue hold nothing but IdleGCTasks?
+  bool only_idle_tasks_queued() const;
+  //     Is there a task get_task can hand to the argument worker?
+  bool has_task_for(uint which);
+  //     Move the ordinary tasks at the head of the list to the deques.
+  void add_stealable_tasks(GCTaskQueue* list);
+  //     Claim a task from the deques, or return NULL if there are none.
+  GCTask* steal_task(uint which);
+  //     Note the completion of a stealable task by the argument worker.
+  void note_stealable_completion(uint which);
   // Modifier methods with some semantics.
   //     Is any worker blocking handing out new tasks?
   uint blocking_worker() const {
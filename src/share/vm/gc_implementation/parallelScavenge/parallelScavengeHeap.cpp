@@ -547,6 +547,52 @@ void ParallelScavengeHeap::object_iterate(ObjectClosure* cl) {
   old_gen()->object_iterate(cl);
 }
 
+// Runs a gang task on the GC task threads, one GCTask per active worker.
+class ParObjectIterateGCTask : public GCTask {
+  AbstractGangTask* _task;
+  uint              _worker_id;
+ public:
+  ParObjectIterateGCTask(AbstractGangTask* task, uint worker_id) :
+    _task(task), _worker_id(worker_id) { }
+
+  char* name() { return (char *)"par-object-iterate-task"; }
+
+  void do_it(GCTaskManager* manager, uint which) {
+    _task->work(_worker_id);
+  }
+};
+
+uint ParallelScavengeHeap::run_par_object_iterate_task(AbstractGangTask* task) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint n_workers = gc_task_manager()->active_workers();
+  _par_iterate_claim = 0;
+
+  ResourceMark rm;
+  GCTaskQueue* q = GCTaskQueue::create();
+  for (uint i = 0; i < n_workers; i++) {
+    q->enqueue(new ParObjectIterateGCTask(task, i));
+  }
+  gc_task_manager()->execute_and_wait(q);
+  return n_workers;
+}
+
+void ParallelScavengeHeap::par_object_iterate(ObjectClosure* cl, uint worker_id) {
+  // The young gen spaces are small next to the old gen, each one is
+  // handed out whole.
+  while (true) {
+    jint unit = Atomic::add(1, &_par_iterate_claim) - 1;
+    if (unit == 0) {
+      young_gen()->eden_space()->object_iterate(cl);
+    } else if (unit == 1) {
+      young_gen()->from_space()->object_iterate(cl);
+    } else if (unit == 2) {
+      young_gen()->to_space()->object_iterate(cl);
+    } else if (!old_gen()->object_iterate_block(cl, (size_t)(unit - 3))) {
+      return;
+    }
+  }
+}
+
 
 HeapWord* ParallelScavengeHeap::block_start(const void* addr) const {
   if (young_gen()->is_in_reserved(addr)) {
@@ -61,6 +61,10 @@ class ParallelScavengeHeap : public CollectedHeap {
   AdjoiningGenerations* _gens;
   unsigned int _death_march_count;
 
+  // Next unit of work handed out by par_object_iterate(): the young
+  // gen spaces, followed by the blocks of the old gen.
+  volatile jint _par_iterate_claim;
+
   // The task manager
   static GCTaskManager* _gc_task_manager;
 
@@ -75,7 +79,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   HeapWord* mem_allocate_old_gen(size_t size);
 
  public:
-  ParallelScavengeHeap() : CollectedHeap(), _death_march_count(0) { }
+  ParallelScavengeHeap() : CollectedHeap(), _death_march_count(0),
+                           _par_iterate_claim(0) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -208,6 +213,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   void oop_iterate(ExtendedOopClosure* cl);
   void object_iterate(ObjectClosure* cl);
   void safe_object_iterate(ObjectClosure* cl) { object_iterate(cl); }
+  uint run_par_object_iterate_task(AbstractGangTask* task);
+  void par_object_iterate(ObjectClosure* cl, uint worker_id);
 
   HeapWord* block_start(const void* addr) const;
   size_t block_size(const HeapWord* addr) const;
@@ -431,6 +431,28 @@ size_t PSOldGen::available_for_contraction() {
   return 0;
 }
 
+bool PSOldGen::object_iterate_block(ObjectClosure* cl, size_t index) {
+  MutableSpace* space = object_space();
+  size_t block_word = index * IterateBlockSize;
+  if (block_word >= pointer_delta(space->top(), space->bottom())) {
+    return false;
+  }
+  HeapWord* begin = space->bottom() + block_word;
+  HeapWord* end = MIN2(space->top(), begin + IterateBlockSize);
+
+  // The object crossing into the block belongs to the previous one.
+  HeapWord* p = start_array()->object_start(begin);
+  if (p < begin) {
+    p += oop(p)->size();
+  }
+  while (p < end) {
+    oop obj = oop(p);
+    cl->do_object(obj);
+    p += obj->size();
+  }
+  return true;
+}
+
 void PSOldGen::print() const { print_on(tty);}
 void PSOldGen::print_on(outputStream* st) const {
   st->print(" %-15s", name());
@@ -170,6 +170,13 @@ class PSOldGen : public CHeapObj<mtGC> {
   void oop_iterate_no_header(OopClosure* cl) { object_space()->oop_iterate_no_header(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
 
+  // Parallel iteration. The used part of the space is divided into blocks
+  // of IterateBlockSize words; object_iterate_block() applies "cl" to the
+  // objects that start in block "index" and returns false once "index" is
+  // past the top of the space.
+  enum { IterateBlockSize = 1024 * 1024 };
+  bool object_iterate_block(ObjectClosure* cl, size_t index);
+
   // Debugging - do not use for time critical operations
   virtual void print() const;
   virtual void print_on(outputStream* st) const;
@@ -1420,6 +1420,10 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
     return sd.region_to_addr(full_cp);
   }
 
+  if (ParallelOldIncrementalCompaction && id == old_space_id) {
+    return compute_dense_prefix_incremental(id, full_cp, top_cp);
+  }
+
   const size_t space_live = pointer_delta(new_top, bottom);
   const size_t space_used = space->used_in_words();
   const size_t space_capacity = space->capacity_in_words();
@@ -1473,6 +1477,49 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
+// Walk down from the top of the space, accumulating the dead space in each
+// region, until the regions passed hold the requested share of all the dead
+// space.  Only those (sparse) regions are compacted; the dense regions below
+// them are left in place, trading some fragmentation for a shorter pause.
+// The periodic maximum compaction in compute_dense_prefix() bounds the
+// fragmentation that can build up.
+HeapWord*
+PSParallelCompact::compute_dense_prefix_incremental(const SpaceId id,
+                                                    const RegionData* full_cp,
+                                                    const RegionData* top_cp)
+{
+  const size_t region_size = ParallelCompactData::RegionSize;
+  const ParallelCompactData& sd = summary_data();
+
+  const MutableSpace* const space = _space_info[id].space();
+  HeapWord* const top = space->top();
+  const size_t space_live = pointer_delta(_space_info[id].new_top(),
+                                          space->bottom());
+  const size_t dead_wood_max = space->used_in_words() - space_live;
+  const size_t dead_goal = dead_wood_max / 100 *
+                           ParallelOldIncrementalReclaimPercent;
+
+  size_t dead = 0;
+  const RegionData* cp = top_cp;
+  do {
+    --cp;
+    HeapWord* const region_beg = sd.region_to_addr(cp);
+    const size_t used = pointer_delta(MIN2(region_beg + region_size, top),
+                                      region_beg);
+    dead += used - MIN2(used, cp->data_size());
+  } while (cp > full_cp && dead < dead_goal);
+
+  if (TraceParallelOldGCDensePrefix) {
+    tty->print_cr("incremental: dead_wood_max=" SIZE_FORMAT " "
+                  "dead_goal=" SIZE_FORMAT " reclaimed=" SIZE_FORMAT " "
+                  "compacted_regions=" SIZE_FORMAT,
+                  dead_wood_max, dead_goal, dead,
+                  pointer_delta(top_cp, cp, sizeof(RegionData)));
+  }
+
+  return sd.region_to_addr(cp);
+}
+
 #ifndef PRODUCT
 void
 PSParallelCompact::fill_with_live_objects(SpaceId id, HeapWord* const start,
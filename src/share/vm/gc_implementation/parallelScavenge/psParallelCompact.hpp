@@ -1078,6 +1078,14 @@ class PSParallelCompact : AllStatic {
   static HeapWord* compute_dense_prefix(const SpaceId id,
                                         bool maximum_compaction);
 
+  // Compute the dense prefix for an incremental full gc: the highest region
+  // boundary above which ParallelOldIncrementalReclaimPercent of the dead
+  // space lies.  The argument full_cp must be the first region in the space
+  // that is not completely live.
+  static HeapWord* compute_dense_prefix_incremental(const SpaceId id,
+                                                    const RegionData* full_cp,
+                                                    const RegionData* top_cp);
+
   // Return true if dead space crosses onto the specified Region; bit must be
   // the bit index corresponding to the first word of the Region.
   static inline bool dead_space_crosses_boundary(const RegionData* region,
@@ -83,10 +83,10 @@ void GCTracer::report_gc_end(const Ticks& timestamp, TimePartitions* time_partit
 void GCTracer::report_gc_reference_stats(const ReferenceProcessorStats& rps) const {
   assert_set_gc_id();
 
-  send_reference_stats_event(REF_SOFT, rps.soft_count());
-  send_reference_stats_event(REF_WEAK, rps.weak_count());
-  send_reference_stats_event(REF_FINAL, rps.final_count());
-  send_reference_stats_event(REF_PHANTOM, rps.phantom_count());
+  for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+    ReferenceType type = (ReferenceType)i;
+    send_reference_stats_event(type, rps.count(type), rps.time_ms(type), rps.workers(type));
+  }
 }
 
 #if INCLUDE_SERVICES
@@ -140,7 +140,8 @@ class GCTracer : public ResourceObj {
   void send_gc_heap_summary_event(GCWhen::Type when, const GCHeapSummary& heap_summary) const;
   void send_meta_space_summary_event(GCWhen::Type when, const MetaspaceSummary& meta_space_summary) const;
   void send_metaspace_chunk_free_list_summary(GCWhen::Type when, Metaspace::MetadataType mdtype, const MetaspaceChunkFreeListSummary& summary) const;
-  void send_reference_stats_event(ReferenceType type, size_t count) const;
+  void send_reference_stats_event(ReferenceType type, size_t count,
+                                  double time_ms, uint workers) const;
   void send_phase_events(TimePartitions* time_partitions) const;
 };
 
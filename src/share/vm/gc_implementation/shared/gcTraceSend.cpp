@@ -53,12 +53,15 @@ void GCTracer::send_garbage_collection_event() const {
   }
 }
 
-void GCTracer::send_reference_stats_event(ReferenceType type, size_t count) const {
+void GCTracer::send_reference_stats_event(ReferenceType type, size_t count,
+                                          double time_ms, uint workers) const {
   EventGCReferenceStatistics e;
   if (e.should_commit()) {
       e.set_gcId(_shared_gc_info.gc_id().id());
       e.set_type((u1)type);
       e.set_count(count);
+      e.set_processingTime(time_ms);
+      e.set_workers(workers);
       e.commit();
   }
 }
@@ -39,6 +39,8 @@
 // class defines the functions that a heap must implement, and contains
 // infrastructure common to all heaps.
 
+class AbstractGangTask;
+class WorkGang;
 class AdaptiveSizePolicy;
 class BarrierSet;
 class CollectorPolicy;
@@ -514,6 +516,26 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // over live objects.
   virtual void safe_object_iterate(ObjectClosure* cl) = 0;
 
+  // Runs "task" on the parallel GC worker threads of the heap, at a
+  // safepoint and outside of a collection, and returns the number of
+  // workers it was run on. Each worker may call par_object_iterate()
+  // with its worker id to visit its share of the objects in the heap.
+  // Returns 0 without running the task if the heap does not support
+  // parallel object iteration.
+  virtual uint run_par_object_iterate_task(AbstractGangTask* task) { return 0; }
+
+  // Iterate over the objects claimed by the given worker of a task
+  // started by run_par_object_iterate_task(), calling "cl.do_object"
+  // on each. Together the workers visit every object once.
+  virtual void par_object_iterate(ObjectClosure* cl, uint worker_id) {
+    ShouldNotReachHere();
+  }
+
+  // Returns the gang of parallel GC worker threads that may be used to
+  // run safepoint cleanup tasks, or NULL if the heap has none.  The gang
+  // must be idle whenever a safepoint begins.
+  virtual WorkGang* get_safepoint_workers() { return NULL; }
+
   // NOTE! There is no requirement that a collector implement these
   // functions.
   //
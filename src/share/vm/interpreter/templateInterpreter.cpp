@@ -27,6 +27,7 @@
 #include "interpreter/interpreterGenerator.hpp"
 #include "interpreter/interpreterRuntime.hpp"
 #include "interpreter/templateTable.hpp"
+#include "runtime/stubRoutines.hpp"
 
 #ifndef CC_INTERP
 
@@ -401,6 +402,16 @@ void TemplateInterpreterGenerator::generate_all() {
     method_entry(java_util_zip_CRC32_updateByteBuffer)
   }
 
+  if (UseCRC32CIntrinsics && StubRoutines::updateBytesCRC32C() != NULL) {
+    method_entry(java_util_zip_CRC32C_updateBytes)
+    method_entry(java_util_zip_CRC32C_updateDirectByteBuffer)
+  }
+
+  if (UseAdler32Intrinsics && StubRoutines::updateBytesAdler32() != NULL) {
+    method_entry(java_util_zip_Adler32_updateBytes)
+    method_entry(java_util_zip_Adler32_updateByteBuffer)
+  }
+
   initialize_method_handle_entries();
 
   // all native method kinds (must be one contiguous block)
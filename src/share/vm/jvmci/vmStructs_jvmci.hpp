@@ -98,6 +98,10 @@
   static_field(StubRoutines,                   _sha512_implCompressMB,                 address)                                      \
   static_field(StubRoutines,                   _montgomeryMultiply,                    address)                                      \
   static_field(StubRoutines,                   _montgomerySquare,                      address)                                      \
+  static_field(StubRoutines,                   _vectorizedMismatch,                    address)                                      \
+  static_field(StubRoutines,                   _updateBytesCRC32C,                     address)                                      \
+  static_field(StubRoutines,                   _updateBytesAdler32,                    address)                                      \
+  static_field(StubRoutines,                   _counterMode_AESCrypt,                  address)                                      \
                                                                                                                                      \
   volatile_nonstatic_field(ObjectMonitor,      _cxq,                                   ObjectWaiter*)                                \
   volatile_nonstatic_field(ObjectMonitor,      _EntryList,                             ObjectWaiter*)                                \
@@ -114,6 +118,7 @@
   volatile_nonstatic_field(JavaThread,         _doing_unsafe_access,                   bool)                                         \
   nonstatic_field(JavaThread,                  _pending_deoptimization,                int)                                          \
   nonstatic_field(JavaThread,                  _pending_failed_speculation,            jlong)                                        \
+  volatile_nonstatic_field(JavaThread,         _polling_page,                          void*)                                        \
   nonstatic_field(JavaThread,                  _pending_transfer_to_interpreter,       bool)                                         \
   nonstatic_field(JavaThread,                  _jvmci_counters,                        jlong*)                                       \
   nonstatic_field(JavaThread,                  _jvmci_reserved0,                       jlong)                                        \
@@ -28,9 +28,11 @@
 #include "memory/genCollectedHeap.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/mutex.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/workgroup.hpp"
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/parallelScavenge/parallelScavengeHeap.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -189,6 +191,53 @@ bool KlassInfoTable::record_instance(const oop obj) {
   }
 }
 
+class KlassInfoMergeClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  bool _success;
+ public:
+  KlassInfoMergeClosure(KlassInfoTable* table) : _dest(table), _success(true) {}
+  void do_cinfo(KlassInfoEntry* cie) {
+    _success &= _dest->merge_entry(cie);
+  }
+  bool success() { return _success; }
+};
+
+// merge from table
+bool KlassInfoTable::merge(KlassInfoTable* table) {
+  KlassInfoMergeClosure closure(this);
+  table->iterate(&closure);
+  return closure.success();
+}
+
+bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
+  Klass*          k = cie->klass();
+  KlassInfoEntry* elt = lookup(k);
+  // elt may be NULL if it's a new klass for which we
+  // could not allocate space for a new entry in the hashtable.
+  if (elt != NULL) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  }
+  return false;
+}
+
+class KlassInfoResetClosure : public KlassInfoClosure {
+ public:
+  void do_cinfo(KlassInfoEntry* cie) {
+    cie->set_count(0);
+    cie->set_words(0);
+  }
+};
+
+void KlassInfoTable::reset() {
+  KlassInfoResetClosure closure;
+  iterate(&closure);
+  _size_of_instances_in_words = 0;
+}
+
 void KlassInfoTable::iterate(KlassInfoClosure* cic) {
   assert(_size == 0 || _buckets != NULL, "Allocation failure should have been caught");
   for (int index = 0; index < _size; index++) {
@@ -483,11 +532,71 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
+// Heap inspection for every worker.
+// When native OOM happens for KlassInfoTable, set _success to false.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  KlassInfoTable* _shared_cit;
+  BoolObjectClosure* _filter;
+  size_t _missed_count;
+  bool _success;
+  Mutex _mutex;
+
+ public:
+  ParHeapInspectTask(KlassInfoTable* shared_cit, BoolObjectClosure* filter) :
+      AbstractGangTask("Iterating heap"),
+      _shared_cit(shared_cit),
+      _filter(filter),
+      _missed_count(0),
+      _success(true),
+      _mutex(Mutex::leaf, "Parallel heap iteration data merge lock") {}
+
+  size_t missed_count() const { return _missed_count; }
+  bool success()              { return _success; }
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    KlassInfoTable cit(false);
+    if (cit.allocation_failed()) {
+      // fail to allocate memory, stop parallel mode
+      MutexLockerEx x(&_mutex, Mutex::_no_safepoint_check_flag);
+      _success = false;
+      return;
+    }
+    RecordInstanceClosure ric(&cit, _filter);
+    Universe::heap()->par_object_iterate(&ric, worker_id);
+
+    MutexLockerEx x(&_mutex, Mutex::_no_safepoint_check_flag);
+    _missed_count += ric.missed_count();
+    if (!_shared_cit->merge(&cit)) {
+      _success = false;
+    }
+  }
+};
+
 size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
   ResourceMark rm;
 
+  // Try parallel first. During a collection the GC workers are busy, and
+  // the filter may depend on the state of the collection.
+  CollectedHeap* heap = Universe::heap();
+  if (ParallelHeapInspection &&
+      SafepointSynchronize::is_at_safepoint() &&
+      Thread::current()->is_VM_thread() &&
+      !heap->is_gc_active()) {
+    ParHeapInspectTask task(cit, filter);
+    if (heap->run_par_object_iterate_task(&task) > 0 && task.success()) {
+      return task.missed_count();
+    }
+    if (!task.success()) {
+      // Some of the worker tables were lost; start over on a clean
+      // table with the serial walk.
+      cit->reset();
+    }
+  }
+
   RecordInstanceClosure ric(cit, filter);
-  Universe::heap()->object_iterate(&ric);
+  heap->object_iterate(&ric);
   return ric.missed_count();
 }
 
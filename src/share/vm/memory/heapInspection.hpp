@@ -253,6 +253,12 @@ class KlassInfoTable: public StackObj {
   bool record_instance(const oop obj);
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
+  // Adds the counts of "table" to this table. Returns false if some of
+  // the entries could not be merged for lack of C-heap.
+  bool merge(KlassInfoTable* table);
+  bool merge_entry(const KlassInfoEntry* cie);
+  // Clears the counts, keeping the entries.
+  void reset();
   size_t size_of_instances_in_words() const;
 
   friend class KlassInfoHisto;
@@ -187,6 +187,19 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Remove from a list by size.  Selects list based on size of chunk.
   Metachunk* free_chunks_get(size_t chunk_word_size);
 
+  // Add a chunk that is not in use by any SpaceManager to the free
+  // list for its size.
+  void add_free_chunk(Metachunk* chunk);
+
+  // Chunk up the free memory [start, end) of a VirtualSpaceNode, largest
+  // chunks first, and add the chunks to the free lists.
+  void carve_free_chunks(VirtualSpaceNode* node, MetaWord* start, MetaWord* end);
+
+  // If there is no free chunk of the (non-humongous) size, split a free
+  // chunk of a larger size.  Returns the chunk, still on its free list,
+  // or NULL.
+  Metachunk* split_free_chunk(size_t chunk_word_size);
+
 #define index_bounds_check(index)                                         \
   assert(index == SpecializedIndex ||                                     \
          index == SmallIndex ||                                           \
@@ -369,6 +382,10 @@ class VirtualSpaceNode : public CHeapObj<mtClass> {
   // in the node from any freelist.
   void purge(ChunkManager* chunk_manager);
 
+  // Merge runs of adjacent free chunks into larger chunks and uncommit
+  // the memory of the free chunks at the top of the node.
+  void reclaim_free_chunks(ChunkManager* chunk_manager);
+
   // If an allocation doesn't fit in the current node a new node is created.
   // Allocate chunks out of the remaining committed space in this node
   // to avoid wasting that memory.
@@ -1123,6 +1140,20 @@ void VirtualSpaceList::purge(ChunkManager* chunk_manager) {
       prev_vsl = vsl;
     }
   }
+
+  // Give back the memory of the free chunks in the remaining nodes.
+  // The CDS archive is written from the nodes, so keep them as they are.
+  if (MetaspaceReclaimFreeChunks && !DumpSharedSpaces) {
+    VirtualSpaceListIterator iter(virtual_space_list());
+    while (iter.repeat()) {
+      VirtualSpaceNode* vsn = iter.get_next();
+      size_t before = vsn->committed_words();
+      vsn->reclaim_free_chunks(chunk_manager);
+      size_t after = vsn->committed_words();
+      assert(after <= before, "Inconsistency");
+      dec_committed_words(before - after);
+    }
+  }
 #ifdef ASSERT
   if (purged_vsl != NULL) {
     // List should be stable enough to use an iterator here.
@@ -1136,6 +1167,71 @@ void VirtualSpaceList::purge(ChunkManager* chunk_manager) {
 }
 
 
+// Walk the chunks of the node.  Runs of adjacent free chunks are
+// removed from the free lists and chunked up again, largest chunks
+// first.  A run of free chunks that ends at top() is given back: top()
+// is lowered to the first commit granule boundary in the run and the
+// memory above it is uncommitted.
+void VirtualSpaceNode::reclaim_free_chunks(ChunkManager* chunk_manager) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be called at safepoint");
+  assert_lock_strong(SpaceManager::expand_lock());
+  DEBUG_ONLY(verify_container_count();)
+
+  MetaWord* run_start = NULL;
+  size_t run_length = 0;
+  MetaWord* cur = bottom();
+  while (cur <= top()) {
+    Metachunk* chunk = (Metachunk*) cur;
+    if (cur < top() && chunk->is_tagged_free()) {
+      if (run_start == NULL) {
+        run_start = cur;
+        run_length = 0;
+      }
+      run_length++;
+      cur += chunk->word_size();
+      continue;
+    }
+
+    // End of a run of free chunks, either at a chunk in use or at top().
+    bool at_top = cur == top();
+    if (run_start != NULL && (run_length > 1 || at_top)) {
+      MetaWord* run_end = cur;
+      for (MetaWord* p = run_start; p < run_end; ) {
+        Metachunk* free_chunk = (Metachunk*) p;
+        p += free_chunk->word_size();
+        chunk_manager->remove_chunk(free_chunk);
+      }
+      if (at_top && !is_pre_committed()) {
+        MetaWord* boundary = (MetaWord*) align_ptr_up(run_start, Metaspace::commit_alignment());
+        run_end = MIN2(boundary, top());
+        set_top(run_end);
+      }
+      chunk_manager->carve_free_chunks(this, run_start, run_end);
+    }
+    run_start = NULL;
+
+    if (at_top) {
+      break;
+    }
+    cur += chunk->word_size();
+  }
+
+  // Uncommit the whole commit granules above top().
+  if (!is_pre_committed()) {
+    MetaWord* keep = (MetaWord*) align_ptr_up(top(), Metaspace::commit_alignment());
+    size_t uncommit_bytes = pointer_delta(end(), keep, sizeof(char));
+    if (uncommit_bytes > 0) {
+      if (TraceMetadataChunkAllocation) {
+        gclog_or_tty->print_cr("VirtualSpaceNode::reclaim_free_chunks: uncommit "
+                               SIZE_FORMAT " bytes at " PTR_FORMAT,
+                               uncommit_bytes, keep);
+      }
+      virtual_space()->shrink_by(uncommit_bytes);
+    }
+  }
+  DEBUG_ONLY(verify_container_count();)
+}
+
 // This function looks at the mmap regions in the metaspace without locking.
 // The chunks are added with store ordering and not deleted except for at
 // unloading time during a safepoint.
@@ -1829,6 +1925,10 @@ Metachunk* ChunkManager::free_chunks_get(size_t word_size) {
 
     chunk = free_list->head();
 
+    if (chunk == NULL && MetaspaceReclaimFreeChunks) {
+      chunk = split_free_chunk(word_size);
+    }
+
     if (chunk == NULL) {
       return NULL;
     }
@@ -1865,11 +1965,9 @@ Metachunk* ChunkManager::free_chunks_get(size_t word_size) {
   // Remove it from the links to this freelist
   chunk->set_next(NULL);
   chunk->set_prev(NULL);
-#ifdef ASSERT
   // Chunk is no longer on any freelist. Setting to false make container_count_slow()
-  // work.
+  // and VirtualSpaceNode::reclaim_free_chunks() work.
   chunk->set_is_tagged_free(false);
-#endif
   chunk->container()->inc_container_count();
 
   slow_locked_verify();
@@ -1906,6 +2004,68 @@ Metachunk* ChunkManager::chunk_freelist_allocate(size_t word_size) {
   return chunk;
 }
 
+void ChunkManager::add_free_chunk(Metachunk* chunk) {
+  assert_lock_strong(SpaceManager::expand_lock());
+  assert(chunk->next() == NULL && chunk->prev() == NULL, "Already on a list");
+
+  chunk->set_is_tagged_free(true);
+  ChunkIndex index = list_index(chunk->word_size());
+  if (index != HumongousIndex) {
+    free_chunks(index)->return_chunk_at_head(chunk);
+  } else {
+    humongous_dictionary()->return_chunk(chunk);
+  }
+  inc_free_chunks_total(chunk->word_size());
+}
+
+void ChunkManager::carve_free_chunks(VirtualSpaceNode* node, MetaWord* start, MetaWord* end) {
+  assert_lock_strong(SpaceManager::expand_lock());
+
+  MetaWord* cur = start;
+  for (int i = (int)MediumIndex; i >= (int)ZeroIndex; --i) {
+    size_t chunk_size = free_chunks((ChunkIndex)i)->size();
+    while (pointer_delta(end, cur, sizeof(MetaWord)) >= chunk_size) {
+      Metachunk* chunk = ::new (cur) Metachunk(chunk_size, node);
+      add_free_chunk(chunk);
+      cur += chunk_size;
+    }
+  }
+  // This always adds up because all the chunk sizes are multiples of
+  // the smallest chunk size.
+  assert(cur == end, "Free memory left over");
+}
+
+Metachunk* ChunkManager::split_free_chunk(size_t word_size) {
+  assert_lock_strong(SpaceManager::expand_lock());
+  ChunkIndex index = list_index(word_size);
+  assert(index != HumongousIndex, "Humongous chunks are not split");
+
+  for (ChunkIndex i = next_chunk_index(index); i < HumongousIndex; i = next_chunk_index(i)) {
+    Metachunk* larger = free_chunks(i)->head();
+    if (larger == NULL) {
+      continue;
+    }
+    VirtualSpaceNode* node = larger->container();
+    MetaWord* start = larger->bottom();
+    MetaWord* end = start + larger->word_size();
+    assert_is_size_aligned(larger->word_size(), word_size);
+    remove_chunk(larger);
+
+    for (MetaWord* cur = start; cur < end; cur += word_size) {
+      Metachunk* chunk = ::new (cur) Metachunk(word_size, node);
+      add_free_chunk(chunk);
+    }
+    if (TraceMetadataChunkAllocation && Verbose) {
+      gclog_or_tty->print_cr("ChunkManager::split_free_chunk: split " PTR_FORMAT
+                             " into " SIZE_FORMAT " chunks of size " SIZE_FORMAT,
+                             start, pointer_delta(end, start, sizeof(MetaWord)) / word_size,
+                             word_size);
+    }
+    return free_chunks(index)->head();
+  }
+  return NULL;
+}
+
 void ChunkManager::print_on(outputStream* out) const {
   if (PrintFLSStatistics != 0) {
     const_cast<ChunkManager *>(this)->humongous_dictionary()->report_statistics();
@@ -2266,7 +2426,7 @@ void ChunkManager::return_chunks(ChunkIndex index, Metachunk* chunks) {
     // Capture the next link before it is changed
     // by the call to return_chunk_at_head();
     Metachunk* next = cur->next();
-    DEBUG_ONLY(cur->set_is_tagged_free(true);)
+    cur->set_is_tagged_free(true);
     list->return_chunk_at_head(cur);
     cur = next;
   }
@@ -2337,9 +2497,7 @@ SpaceManager::~SpaceManager() {
   Metachunk* humongous_chunks = chunks_in_use(HumongousIndex);
 
   while (humongous_chunks != NULL) {
-#ifdef ASSERT
     humongous_chunks->set_is_tagged_free(true);
-#endif
     if (TraceMetadataChunkAllocation && Verbose) {
       gclog_or_tty->print(PTR_FORMAT " (" SIZE_FORMAT ") ",
                           humongous_chunks,
@@ -216,50 +216,72 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(
   _soft_ref_timestamp_clock = java_lang_ref_SoftReference::clock();
 
   bool trace_time = PrintGCDetails && PrintReferenceGC;
+  ReferenceProcessorStats stats;
+  double start;
+  uint workers;
 
   // Soft references
-  size_t soft_count = 0;
   {
     GCTraceTime tt("SoftReference", trace_time, false, gc_timer, gc_id);
-    soft_count =
+    start = os::elapsedTime();
+    size_t soft_count =
       process_discovered_reflist(_discoveredSoftRefs, _current_soft_ref_policy, true,
-                                 is_alive, keep_alive, complete_gc, task_executor);
+                                 is_alive, keep_alive, complete_gc, task_executor,
+                                 &workers);
+    stats.set_phase(REF_SOFT, soft_count,
+                    (os::elapsedTime() - start) * MILLIUNITS, workers);
+    print_phase_stats(stats, REF_SOFT);
   }
 
   update_soft_ref_master_clock();
 
   // Weak references
-  size_t weak_count = 0;
   {
     GCTraceTime tt("WeakReference", trace_time, false, gc_timer, gc_id);
-    weak_count =
+    start = os::elapsedTime();
+    size_t weak_count =
       process_discovered_reflist(_discoveredWeakRefs, NULL, true,
-                                 is_alive, keep_alive, complete_gc, task_executor);
+                                 is_alive, keep_alive, complete_gc, task_executor,
+                                 &workers);
+    stats.set_phase(REF_WEAK, weak_count,
+                    (os::elapsedTime() - start) * MILLIUNITS, workers);
+    print_phase_stats(stats, REF_WEAK);
   }
 
   // Final references
-  size_t final_count = 0;
   {
     GCTraceTime tt("FinalReference", trace_time, false, gc_timer, gc_id);
-    final_count =
+    start = os::elapsedTime();
+    size_t final_count =
       process_discovered_reflist(_discoveredFinalRefs, NULL, false,
-                                 is_alive, keep_alive, complete_gc, task_executor);
+                                 is_alive, keep_alive, complete_gc, task_executor,
+                                 &workers);
+    stats.set_phase(REF_FINAL, final_count,
+                    (os::elapsedTime() - start) * MILLIUNITS, workers);
+    print_phase_stats(stats, REF_FINAL);
   }
 
   // Phantom references
-  size_t phantom_count = 0;
   {
     GCTraceTime tt("PhantomReference", trace_time, false, gc_timer, gc_id);
-    phantom_count =
+    start = os::elapsedTime();
+    size_t phantom_count =
       process_discovered_reflist(_discoveredPhantomRefs, NULL, false,
-                                 is_alive, keep_alive, complete_gc, task_executor);
+                                 is_alive, keep_alive, complete_gc, task_executor,
+                                 &workers);
 
     // Process cleaners, but include them in phantom statistics.  We expect
     // Cleaner references to be temporary, and don't want to deal with
     // possible incompatibilities arising from making it more visible.
+    uint cleaner_workers;
     phantom_count +=
       process_discovered_reflist(_discoveredCleanerRefs, NULL, true,
-                                 is_alive, keep_alive, complete_gc, task_executor);
+                                 is_alive, keep_alive, complete_gc, task_executor,
+                                 &cleaner_workers);
+    stats.set_phase(REF_PHANTOM, phantom_count,
+                    (os::elapsedTime() - start) * MILLIUNITS,
+                    MAX2(workers, cleaner_workers));
+    print_phase_stats(stats, REF_PHANTOM);
   }
 
   // Weak global JNI references. It would make more sense (semantically) to
@@ -275,7 +297,19 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(
     process_phaseJNI(is_alive, keep_alive, complete_gc);
   }
 
-  return ReferenceProcessorStats(soft_count, weak_count, final_count, phantom_count);
+  return stats;
+}
+
+// Completes the -XX:+PrintReferenceGC line of a reference type; the time
+// is printed by its GCTraceTime.
+void ReferenceProcessor::print_phase_stats(const ReferenceProcessorStats& stats,
+                                           ReferenceType type) const {
+  if (PrintReferenceGC && PrintGCDetails) {
+    gclog_or_tty->print(", " SIZE_FORMAT " refs", stats.count(type));
+    if (_processing_is_mt) {
+      gclog_or_tty->print(", %u workers", stats.workers(type));
+    }
+  }
 }
 
 #ifndef PRODUCT
@@ -895,6 +929,33 @@ void ReferenceProcessor::balance_all_queues() {
   balance_queues(_discoveredCleanerRefs);
 }
 
+uint ReferenceProcessor::ergo_proc_thread_count(size_t ref_count) const {
+  if (ReferencesPerThread == 0) {
+    return _num_q;
+  }
+  size_t thread_count = 1 + (ref_count / ReferencesPerThread);
+  return (uint) MIN2(thread_count, (size_t) _num_q);
+}
+
+// Temporarily lowers the active MT degree of a ReferenceProcessor
+// to the number of workers picked for a phase, so that balance_queues()
+// moves the references into the lists of those workers.
+class RefProcMTDegreeAdjuster : public StackObj {
+  ReferenceProcessor* _rp;
+  uint                _saved_num_q;
+
+ public:
+  RefProcMTDegreeAdjuster(ReferenceProcessor* rp, uint ergo_workers) :
+    _rp(rp), _saved_num_q(rp->num_q()) {
+    assert(ergo_workers <= _saved_num_q, "can only lower the degree");
+    _rp->set_active_mt_degree(ergo_workers);
+  }
+
+  ~RefProcMTDegreeAdjuster() {
+    _rp->set_active_mt_degree(_saved_num_q);
+  }
+};
+
 size_t
 ReferenceProcessor::process_discovered_reflist(
   DiscoveredList               refs_lists[],
@@ -903,27 +964,40 @@ ReferenceProcessor::process_discovered_reflist(
   BoolObjectClosure*           is_alive,
   OopClosure*                  keep_alive,
   VoidClosure*                 complete_gc,
-  AbstractRefProcTaskExecutor* task_executor)
+  AbstractRefProcTaskExecutor* task_executor,
+  uint*                        workers_used)
 {
   bool mt_processing = task_executor != NULL && _processing_is_mt;
+
+  size_t total_list_count = total_count(refs_lists);
+
+  // Don't use more workers than there are references to keep busy.
+  // Even a single worker goes through the task executor: switching to
+  // the serial closures here would need the executor's single threaded
+  // mode (see ParNewRefProcTaskExecutor), which later phases can not
+  // leave again.
+  uint active_q = _num_q;
+  uint ergo_workers = 1;
+  if (mt_processing) {
+    ergo_workers = ergo_proc_thread_count(total_list_count);
+  }
+  RefProcMTDegreeAdjuster adjuster(this, mt_processing ? ergo_workers : active_q);
+
   // If discovery used MT and a dynamic number of GC threads, then
   // the queues must be balanced for correctness if fewer than the
   // maximum number of queues were used.  The number of queue used
   // during discovery may be different than the number to be used
   // for processing so don't depend of _num_q < _max_num_q as part
-  // of the test.
-  bool must_balance = _discovery_is_mt;
+  // of the test.  The same holds when fewer workers than the active
+  // MT degree were picked above.
+  bool must_balance = _discovery_is_mt || (mt_processing && ergo_workers < active_q);
 
   if ((mt_processing && ParallelRefProcBalancingEnabled) ||
       must_balance) {
     balance_queues(refs_lists);
   }
 
-  size_t total_list_count = total_count(refs_lists);
-
-  if (PrintReferenceGC && PrintGCDetails) {
-    gclog_or_tty->print(", %u refs", total_list_count);
-  }
+  *workers_used = ergo_workers;
 
   // Phase 1 (soft refs only):
   // . Traverse the list and remove any SoftReferences whose
@@ -933,7 +1007,7 @@ ReferenceProcessor::process_discovered_reflist(
   if (policy != NULL) {
     if (mt_processing) {
       RefProcPhase1Task phase1(*this, refs_lists, policy, true /*marks_oops_alive*/);
-      task_executor->execute(phase1);
+      task_executor->execute(phase1, ergo_workers);
     } else {
       for (uint i = 0; i < _max_num_q; i++) {
         process_phase1(refs_lists[i], policy,
@@ -949,7 +1023,7 @@ ReferenceProcessor::process_discovered_reflist(
   // . Traverse the list and remove any refs whose referents are alive.
   if (mt_processing) {
     RefProcPhase2Task phase2(*this, refs_lists, !discovery_is_atomic() /*marks_oops_alive*/);
-    task_executor->execute(phase2);
+    task_executor->execute(phase2, ergo_workers);
   } else {
     for (uint i = 0; i < _max_num_q; i++) {
       process_phase2(refs_lists[i], is_alive, keep_alive, complete_gc);
@@ -960,7 +1034,7 @@ ReferenceProcessor::process_discovered_reflist(
   // . Traverse the list and process referents as appropriate.
   if (mt_processing) {
     RefProcPhase3Task phase3(*this, refs_lists, clear_referent, true /*marks_oops_alive*/);
-    task_executor->execute(phase3);
+    task_executor->execute(phase3, ergo_workers);
   } else {
     for (uint i = 0; i < _max_num_q; i++) {
       process_phase3(refs_lists[i], clear_referent,
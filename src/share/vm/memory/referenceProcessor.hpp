@@ -283,13 +283,23 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
   }
 
   // Process references with a certain reachability level.
+  // Sets "workers_used" to the number of workers the references
+  // were processed with.
   size_t process_discovered_reflist(DiscoveredList               refs_lists[],
                                     ReferencePolicy*             policy,
                                     bool                         clear_referent,
                                     BoolObjectClosure*           is_alive,
                                     OopClosure*                  keep_alive,
                                     VoidClosure*                 complete_gc,
-                                    AbstractRefProcTaskExecutor* task_executor);
+                                    AbstractRefProcTaskExecutor* task_executor,
+                                    uint*                        workers_used);
+
+  // Prints the count and workers of a reference type for PrintReferenceGC.
+  void print_phase_stats(const ReferenceProcessorStats& stats, ReferenceType type) const;
+
+  // The number of workers to process "ref_count" references with:
+  // one per ReferencesPerThread references, at most the active MT degree.
+  uint ergo_proc_thread_count(size_t ref_count) const;
 
   void process_phaseJNI(BoolObjectClosure* is_alive,
                         OopClosure*        keep_alive,
@@ -640,8 +650,10 @@ public:
   class ProcessTask;
   class EnqueueTask;
 
-  // Executes a task using worker threads.
-  virtual void execute(ProcessTask& task) = 0;
+  // Executes a task using worker threads.  Only the first "ergo_workers"
+  // reference lists contain references, so there is no need to start
+  // more workers than that for a ProcessTask.
+  virtual void execute(ProcessTask& task, uint ergo_workers) = 0;
   virtual void execute(EnqueueTask& task) = 0;
 
   // Switch to single threaded mode.
@@ -25,49 +25,86 @@
 #ifndef SHARE_VM_MEMORY_REFERENCEPROCESSORSTATS_HPP
 #define SHARE_VM_MEMORY_REFERENCEPROCESSORSTATS_HPP
 
+#include "memory/referenceType.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class ReferenceProcessor;
 
 // ReferenceProcessorStats contains statistics about how many references that
-// have been traversed when processing references during garbage collection.
+// have been traversed when processing references during garbage collection,
+// and how long and with how many workers each kind of reference was processed.
 class ReferenceProcessorStats {
-  size_t _soft_count;
-  size_t _weak_count;
-  size_t _final_count;
-  size_t _phantom_count;
+  size_t _count[REF_PHANTOM + 1];
+  double _time_ms[REF_PHANTOM + 1];
+  uint   _workers[REF_PHANTOM + 1];
+
+  void clear() {
+    for (int i = 0; i <= REF_PHANTOM; i++) {
+      _count[i] = 0;
+      _time_ms[i] = 0.0;
+      _workers[i] = 0;
+    }
+  }
+
+  static void check_type(ReferenceType type) {
+    assert(type >= REF_SOFT && type <= REF_PHANTOM, "unexpected reference type");
+  }
 
  public:
-  ReferenceProcessorStats() :
-    _soft_count(0),
-    _weak_count(0),
-    _final_count(0),
-    _phantom_count(0) {}
+  ReferenceProcessorStats() {
+    clear();
+  }
 
   ReferenceProcessorStats(size_t soft_count,
                           size_t weak_count,
                           size_t final_count,
-                          size_t phantom_count) :
-    _soft_count(soft_count),
-    _weak_count(weak_count),
-    _final_count(final_count),
-    _phantom_count(phantom_count)
-  {}
+                          size_t phantom_count) {
+    clear();
+    _count[REF_SOFT] = soft_count;
+    _count[REF_WEAK] = weak_count;
+    _count[REF_FINAL] = final_count;
+    _count[REF_PHANTOM] = phantom_count;
+  }
 
   size_t soft_count() const {
-    return _soft_count;
+    return _count[REF_SOFT];
   }
 
   size_t weak_count() const {
-    return _weak_count;
+    return _count[REF_WEAK];
   }
 
   size_t final_count() const {
-    return _final_count;
+    return _count[REF_FINAL];
   }
 
   size_t phantom_count() const {
-    return _phantom_count;
+    return _count[REF_PHANTOM];
+  }
+
+  // Record the number of references of the given type, the time spent
+  // processing them, and the number of workers they were processed with.
+  // One worker means they were processed serially.
+  void set_phase(ReferenceType type, size_t count, double time_ms, uint workers) {
+    check_type(type);
+    _count[type] = count;
+    _time_ms[type] = time_ms;
+    _workers[type] = workers;
+  }
+
+  size_t count(ReferenceType type) const {
+    check_type(type);
+    return _count[type];
+  }
+
+  double time_ms(ReferenceType type) const {
+    check_type(type);
+    return _time_ms[type];
+  }
+
+  uint workers(ReferenceType type) const {
+    check_type(type);
+    return _workers[type];
   }
 };
 #endif
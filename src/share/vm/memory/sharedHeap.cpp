@@ -63,6 +63,10 @@ SharedHeap::SharedHeap(CollectorPolicy* policy_) :
   }
 }
 
+WorkGang* SharedHeap::get_safepoint_workers() {
+  return _workers;
+}
+
 bool SharedHeap::heap_lock_held_for_gc() {
   Thread* t = Thread::current();
   return    Heap_lock->owned_by_self()
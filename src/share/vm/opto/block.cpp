@@ -1398,6 +1398,15 @@ extern "C" int trace_frequency_order(const void *p0, const void *p1) {
   return diff;
 }
 
+// Mark the blocks which are so rarely executed (uncommon traps, exception
+// paths, slow paths) that they should be kept out of the hot code.
+void PhaseBlockLayout::find_cold_blocks() {
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* b = _cfg.get_block(i);
+    cold[b->_pre_order] = SplitColdBlocks && !b->is_connector() && _cfg.is_uncommon(b);
+  }
+}
+
 // Find edges of interest, i.e, those which can fall through. Presumes that
 // edges which don't fall through are of low frequency and can be generally
 // ignored.  Initialize the list of traces.
@@ -1429,6 +1438,9 @@ void PhaseBlockLayout::find_edges() {
       // We see a merge point, so stop search for the next block
       if (n->num_preds() != 1) break;
 
+      // Keep hot and cold blocks in separate traces.
+      if (!can_join(b, n)) break;
+
       i++;
       assert(n = _cfg.get_block(i), "expecting next block");
       tr->append(n);
@@ -1522,7 +1534,8 @@ void PhaseBlockLayout::grow_traces() {
           // (Or we could remember the first "open" edge, and reset there)
           i = 0;
         }
-      } else if (targ_trace->first_block() == targ_block) {
+      } else if (targ_trace->first_block() == targ_block &&
+                 can_join(src_block, targ_block)) {
         e->set_state(CFGEdge::connected);
         src_trace->append(targ_trace);
         union_traces(src_trace, targ_trace);
@@ -1558,6 +1571,11 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
       continue;
     }
 
+    // Leave hot and cold code in separate traces.
+    if (!can_join(src_block, targ_block)) {
+      continue;
+    }
+
     if (fall_thru_only) {
       // If the edge links the middle of two traces, we can't do anything.
       // Mark the edge and continue.
@@ -1628,6 +1646,38 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  // Move the cold traces behind all the hot ones, keeping their relative
+  // order, so that the hot code of the method is contiguous and the cold
+  // code forms a tail in front of the connector blocks.
+  if (SplitColdBlocks) {
+    Trace ** cold_traces = NEW_ARENA_ARRAY(area, Trace *, new_count);
+    Trace *connectors = NULL;
+    int pos = 1;
+    int cold_count = 0;
+    for (int i = 1; i < new_count; i++) {
+      Trace *t = new_traces[i];
+      if (t->first_block()->is_connector()) {
+        connectors = t;
+      } else if (is_cold(t->first_block())) {
+        cold_traces[cold_count++] = t;
+      } else {
+        new_traces[pos++] = t;
+      }
+    }
+    for (int i = 0; i < cold_count; i++) {
+      new_traces[pos++] = cold_traces[i];
+    }
+    if (connectors != NULL) {
+      new_traces[pos++] = connectors;
+    }
+    assert(pos == new_count, "lost a trace");
+#ifndef PRODUCT
+    if (PrintSplitColdBlocks && cold_count > 0) {
+      tty->print_cr("SplitColdBlocks: %d of %d traces moved behind the hot code", cold_count, new_count);
+    }
+#endif
+  }
+
   // Patch up the successor blocks
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -1653,6 +1703,8 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   memset(next,   0, size*sizeof(Block *));
   prev = NEW_ARENA_ARRAY(area, Block *, size);
   memset(prev  , 0, size*sizeof(Block *));
+  cold = NEW_ARENA_ARRAY(area, bool, size);
+  memset(cold  , 0, size*sizeof(bool));
 
   // List of edges
   edges = new GrowableArray<CFGEdge*>;
@@ -1661,6 +1713,9 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   uf = new UnionFind(size);
   uf->reset(size);
 
+  // Find the blocks to keep out of the hot code.
+  find_cold_blocks();
+
   // Find edges and create traces.
   find_edges();
 
@@ -862,15 +862,24 @@ class PhaseBlockLayout : public Phase {
   Trace **traces;
   Block **next;
   Block **prev;
+  bool *cold;                   // Block index --> block is uncommon
   UnionFind *uf;
 
   // Given a block, find its encompassing Trace
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  // Cold blocks only join traces of other cold blocks, so that they can
+  // be emitted together after all the hot code of the method.
+  bool is_cold(Block *b) const { return cold[b->_pre_order]; }
+  bool can_join(Block *src, Block *targ) const {
+    return is_cold(src) == is_cold(targ);
+  }
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
+  void find_cold_blocks();
   void find_edges();
   void grow_traces();
   void merge_traces(bool loose_connections);
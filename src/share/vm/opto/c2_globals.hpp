@@ -211,6 +211,10 @@
   product(bool, UseCountedLoopSafepoints, false,                            \
           "Force counted loops to keep a safepoint")                        \
                                                                             \
+  diagnostic(bool, StripMineLongLoops, true,                                \
+          "Convert loops with a long induction variable into a loop nest "  \
+          "with an inner int counted loop")                                 \
+                                                                            \
   product(bool, UseLoopPredicate, true,                                     \
           "Generate a predicate to select fast/slow loop versions")         \
                                                                             \
@@ -327,6 +331,16 @@
   develop(bool, SuperWordRTDepCheck, false,                                 \
           "Enable runtime dependency checks.")                              \
                                                                             \
+  product(bool, SuperWordReductions, true,                                  \
+          "Vectorize reductions (sum, product, min, max, and, or, xor) "    \
+          "of loop-carried scalars")                                        \
+                                                                            \
+  product(bool, VectorizedPostLoop, true,                                   \
+          "Drain the iterations left by an unrolled main loop with a "      \
+          "vectorized copy of it before the scalar post-loop, and skip "    \
+          "main loop alignment for short loops when misaligned vectors "    \
+          "are allowed")                                                    \
+                                                                            \
   notproduct(bool, TraceSuperWord, false,                                   \
           "Trace superword transforms")                                     \
                                                                             \
@@ -425,6 +439,11 @@
   product(intx, NodeLimitFudgeFactor, 2000,                                 \
           "Fudge Factor for certain optimizations")                         \
                                                                             \
+  product(uintx, CompilerArenaLimit, 0,                                     \
+          "Maximum arena memory in bytes a single C2 method compilation "   \
+          "may use before the method is marked not compilable at this "     \
+          "tier (0 means no limit)")                                        \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -491,6 +510,13 @@
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
+  product(bool, ReduceAllocationMerges, true,                               \
+          "Split Phis merging non-escaping allocations into Phis of their " \
+          "field values so the allocations can be scalar replaced")         \
+                                                                            \
+  notproduct(bool, PrintReduceAllocationMerges, false,                      \
+          "Print out when allocation merges are reduced")                   \
+                                                                            \
   product(intx, EliminateAllocationArraySizeLimit, 64,                      \
           "Array size (number of elements) limit for scalar replacement")   \
                                                                             \
@@ -531,6 +557,13 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layour")    \
                                                                             \
+  diagnostic(bool, SplitColdBlocks, true,                                   \
+          "Keep uncommon blocks out of hot traces and lay them out after "  \
+          "all hot code in the block layout")                               \
+                                                                            \
+  notproduct(bool, PrintSplitColdBlocks, false,                             \
+          "Print the number of cold traces moved behind the hot code")      \
+                                                                            \
   develop(bool, InlineReflectionGetCallerClass, true,                       \
           "inline sun.reflect.Reflection.getCallerClass(), known to be part "\
           "of base library DLL")                                            \
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compileLog.hpp"
 #include "opto/c2compiler.hpp"
 #include "opto/runtime.hpp"
 #if defined AD_MD_HPP
@@ -116,7 +117,9 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci) {
   while (!env->failing()) {
     // Attempt to compile while subsuming loads into machine instructions.
     Compile C(env, this, target, entry_bci, subsume_loads, do_escape_analysis, eliminate_boxing);
-
+    if (env->log() != NULL) {
+      env->log()->elem("arena high_water='" SIZE_FORMAT "'", C.arena_high_water());
+    }
 
     // Check result and retry if appropriate.
     if (C.failure_reason() != NULL) {
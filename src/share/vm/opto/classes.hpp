@@ -134,6 +134,8 @@ macro(EncodePKlass)
 macro(ExpD)
 macro(FastLock)
 macro(FastUnlock)
+macro(FmaD)
+macro(FmaF)
 macro(Goto)
 macro(Halt)
 macro(If)
@@ -271,6 +273,10 @@ macro(AddVI)
 macro(AddVL)
 macro(AddVF)
 macro(AddVD)
+macro(AddReductionVI)
+macro(AddReductionVL)
+macro(AddReductionVF)
+macro(AddReductionVD)
 macro(SubVB)
 macro(SubVS)
 macro(SubVI)
@@ -281,8 +287,15 @@ macro(MulVS)
 macro(MulVI)
 macro(MulVF)
 macro(MulVD)
+macro(MulReductionVI)
+macro(MulReductionVF)
+macro(MulReductionVD)
 macro(DivVF)
 macro(DivVD)
+macro(FmaVD)
+macro(FmaVF)
+macro(MinReductionVI)
+macro(MaxReductionVI)
 macro(LShiftCntV)
 macro(RShiftCntV)
 macro(LShiftVB)
@@ -300,6 +313,12 @@ macro(URShiftVL)
 macro(AndV)
 macro(OrV)
 macro(XorV)
+macro(AndReductionVI)
+macro(AndReductionVL)
+macro(OrReductionVI)
+macro(OrReductionVL)
+macro(XorReductionVI)
+macro(XorReductionVL)
 macro(LoadVector)
 macro(StoreVector)
 macro(Pack)
@@ -684,7 +684,10 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
                   _print_inlining_list(NULL),
                   _print_inlining_idx(0),
                   _interpreter_frame_size(0),
-                  _max_node_limit(MaxNodeLimit) {
+                  _max_node_limit(MaxNodeLimit),
+                  _arena_limit(CompilerArenaLimit),
+                  _arena_high_water(0),
+                  _arena_phase_peak(0) {
   C = this;
 
   CompileWrapper cw(this);
@@ -998,7 +1001,10 @@ Compile::Compile( ciEnv* ci_env,
     _print_inlining_idx(0),
     _allowed_reasons(0),
     _interpreter_frame_size(0),
-    _max_node_limit(MaxNodeLimit) {
+    _max_node_limit(MaxNodeLimit),
+    _arena_limit(0),              // runtime stubs are needed for C2 to work at all
+    _arena_high_water(0),
+    _arena_phase_peak(0) {
   C = this;
 
 #ifndef PRODUCT
@@ -1109,6 +1115,7 @@ void Compile::Init(int aliaslevel) {
   set_do_method_data_update(false);
   set_rtm_state(NoRTM); // No RTM lock eliding by default
   method_has_option_value("MaxNodeLimit", _max_node_limit);
+  method_has_option_value("CompilerArenaLimit", _arena_limit);
 #if INCLUDE_RTM_OPT
   if (UseRTMLocking && has_method() && (method()->method_data_or_null() != NULL)) {
     int rtm_state = method()->method_data()->rtm_state();
@@ -2124,7 +2131,7 @@ void Compile::Optimize() {
   // Initialize IterGVN with types and values from parse-time GVN
   PhaseIterGVN igvn(initial_gvn());
   {
-    NOT_PRODUCT( TracePhase t2("iterGVN", &_t_iterGVN, TimeCompiler); )
+    TracePhase t2("iterGVN", &_t_iterGVN, true);
     igvn.optimize();
   }
 
@@ -2264,7 +2271,7 @@ void Compile::Optimize() {
 
   // Iterative Global Value Numbering, including ideal transforms
   {
-    NOT_PRODUCT( TracePhase t2("iterGVN2", &_t_iterGVN2, TimeCompiler); )
+    TracePhase t2("iterGVN2", &_t_iterGVN2, true);
     igvn = ccp;
     igvn.optimize();
   }
@@ -3648,15 +3655,17 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator, boo
   : TraceTime(NULL, accumulator, false NOT_PRODUCT( || TimeCompiler ), false),
     _phase_name(name), _dolog(dolog)
 {
+  C = Compile::current();
   if (dolog) {
-    C = Compile::current();
     _log = C->log();
   } else {
-    C = NULL;
     _log = NULL;
   }
+  _outer_arena_peak = C->begin_arena_phase();
+  _start.stamp();
   if (_log != NULL) {
-    _log->begin_head("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
+    _log->begin_head("phase name='%s' nodes='%d' live='%d' arena='" SIZE_FORMAT "'",
+                     _phase_name, C->unique(), C->live_nodes(), C->arena_usage());
     _log->stamp();
     _log->end_head();
   }
@@ -3682,11 +3691,69 @@ Compile::TracePhase::~TracePhase() {
   }
 #endif
 
+  C->check_arena_limit();
+  size_t arena_used = C->arena_usage();
+  size_t arena_peak = C->end_arena_phase(_outer_arena_peak);
+
+  EventCompilerPhaseArena event;
+  if (event.should_commit()) {
+    event.set_starttime(_start);
+    event.set_phase(_phase_name);
+    event.set_compileId(C->compile_id());
+    event.set_arenaUsed(arena_used);
+    event.set_arenaPeak(arena_peak);
+    event.commit();
+  }
+
   if (_log != NULL) {
-    _log->done("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
+    _log->done("phase name='%s' nodes='%d' live='%d' arena='" SIZE_FORMAT "' arena_peak='" SIZE_FORMAT "'",
+               _phase_name, C->unique(), C->live_nodes(), arena_used, arena_peak);
   }
 }
 
+//------------------------------arena_usage------------------------------------
+// Bytes currently held by the arenas this compilation allocates from: the
+// Compile arenas, the ci arena and the compiler thread's resource area.
+size_t Compile::arena_usage() const {
+  return _comp_arena.size_in_bytes() +
+         _node_arena.size_in_bytes() +
+         _old_arena.size_in_bytes() +
+         _Compile_types.size_in_bytes() +
+         _env->arena()->size_in_bytes() +
+         Thread::current()->resource_area()->size_in_bytes();
+}
+
+// Start tracking the arena peak of a nested phase.  Returns the peak of the
+// enclosing phase, to be handed back to end_arena_phase().
+size_t Compile::begin_arena_phase() {
+  size_t outer_peak = _arena_phase_peak;
+  _arena_phase_peak = 0;
+  sample_arena_usage();
+  return outer_peak;
+}
+
+// Returns the arena peak of the phase that ends and folds it into the
+// enclosing phase.
+size_t Compile::end_arena_phase(size_t outer_peak) {
+  sample_arena_usage();
+  size_t peak = _arena_phase_peak;
+  _arena_phase_peak = MAX2(outer_peak, peak);
+  return peak;
+}
+
+// Bail out once the compilation holds more arena memory than allowed.  This
+// is a property of the method's shape, so retrying at this tier is pointless.
+bool Compile::check_arena_limit() {
+  size_t used = sample_arena_usage();
+  if (_arena_limit != 0 && used > _arena_limit) {
+    if (!failing()) {
+      record_method_not_compilable("out of compiler arena memory");
+    }
+    return true;
+  }
+  return false;
+}
+
 //=============================================================================
 // Two Constant's are equal when the type and the value are equal.
 bool Compile::Constant::operator==(const Constant& other) {
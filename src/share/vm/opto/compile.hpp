@@ -109,6 +109,8 @@ class Compile : public Phase {
     CompileLog* _log;
     const char* _phase_name;
     bool _dolog;
+    size_t      _outer_arena_peak;  // Arena peak of the enclosing phase
+    Ticks       _start;
    public:
     TracePhase(const char* name, elapsedTimer* accumulator, bool dolog);
     ~TracePhase();
@@ -294,6 +296,9 @@ class Compile : public Phase {
   int                   _fixed_slots;           // count of frame slots not allocated by the register
                                                 // allocator i.e. locks, original deopt pc, etc.
   uintx                 _max_node_limit;        // Max unique node count during a single compilation.
+  uintx                 _arena_limit;           // Max arena bytes during a single compilation, 0 if unlimited.
+  size_t                _arena_high_water;      // Peak arena_usage() sampled during this compilation
+  size_t                _arena_phase_peak;      // Peak arena_usage() sampled in the innermost TracePhase
   // For deopt
   int                   _orig_pc_slot;
   int                   _orig_pc_slot_offset_in_bytes;
@@ -748,10 +753,23 @@ class Compile : public Phase {
       record_method_not_compilable(reason);
       return true;
     } else {
-      return false;
+      return check_arena_limit();
     }
   }
 
+  // Arena memory accounting
+  size_t arena_usage() const;
+  size_t arena_high_water() const          { return _arena_high_water; }
+  size_t sample_arena_usage() {
+    size_t used = arena_usage();
+    if (used > _arena_phase_peak)  _arena_phase_peak = used;
+    if (used > _arena_high_water)  _arena_high_water = used;
+    return used;
+  }
+  size_t begin_arena_phase();
+  size_t end_arena_phase(size_t outer_peak);
+  bool check_arena_limit();
+
   // Node management
   uint         unique() const              { return _unique; }
   uint         next_unique()               { return _unique++; }
@@ -32,6 +32,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/compile.hpp"
 #include "opto/escape.hpp"
+#include "opto/memnode.hpp"
 #include "opto/phaseX.hpp"
 #include "opto/rootnode.hpp"
 
@@ -41,6 +42,7 @@ ConnectionGraph::ConnectionGraph(Compile * C, PhaseIterGVN *igvn) :
   _next_pidx(0),
   _collecting(true),
   _verify(false),
+  _reduced_merges(false),
   _compile(C),
   _igvn(igvn),
   _node_map(C->comp_arena()) {
@@ -90,9 +92,18 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
   Node* noop_null = igvn->zerocon(T_NARROWOOP);
+  bool reduce_merges = ReduceAllocationMerges && EliminateAllocations &&
+                       C->AliasLevel() >= 3 && !C->has_irreducible_loop();
   ConnectionGraph* congraph = new(C->comp_arena()) ConnectionGraph(C, igvn);
   // Perform escape analysis
-  if (congraph->compute_escape()) {
+  bool has_non_escaping_obj = congraph->compute_escape(reduce_merges);
+  if (congraph->reduced_merges() && !C->failing()) {
+    // Allocation merges were split which invalidated the Connection
+    // Graph. Build it again for the new ideal graph.
+    congraph = new(C->comp_arena()) ConnectionGraph(C, igvn);
+    has_non_escaping_obj = congraph->compute_escape(false);
+  }
+  if (has_non_escaping_obj) {
     // There are non escaping objects.
     C->set_congraph(congraph);
   }
@@ -103,7 +114,7 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
     igvn->hash_delete(noop_null);
 }
 
-bool ConnectionGraph::compute_escape() {
+bool ConnectionGraph::compute_escape(bool reduce_merges) {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
 
@@ -220,6 +231,14 @@ bool ConnectionGraph::compute_escape() {
     return false;
   }
 
+  // 2a. Split Phis merging non-escaping allocations so that the allocations
+  //     are no longer merged. This changes the ideal graph and the caller
+  //     has to rebuild Connection Graph.
+  if (reduce_merges && reduce_allocation_merges(non_escaped_worklist)) {
+    _collecting = false;
+    return false;
+  }
+
   // 3. Adjust scalar_replaceable state of nonescaping objects and push
   //    scalar replaceable allocations on alloc_worklist for processing
   //    in split_unique_types().
@@ -948,10 +967,14 @@ void ConnectionGraph::process_call_arguments(CallNode *call) {
                  (strcmp(call->as_CallLeaf()->_name, "g1_wb_pre")  == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "g1_wb_post") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "updateBytesCRC32") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "updateBytesCRC32C") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "updateBytesAdler32") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "aescrypt_encryptBlock") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "aescrypt_decryptBlock") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "cipherBlockChaining_encryptAESCrypt") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "cipherBlockChaining_decryptAESCrypt") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "counterMode_AESCrypt") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "ghash_processBlocks") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "sha1_implCompress") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "sha1_implCompressMB") == 0 ||
@@ -1710,6 +1733,293 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
   }
 }
 
+// Find Phis which merge only non-escaping allocations and split them.
+// Returns true if the ideal graph was changed.
+bool ConnectionGraph::reduce_allocation_merges(GrowableArray<JavaObjectNode*>& non_escaped_worklist) {
+  Unique_Node_List merges;
+  int non_escaped_length = non_escaped_worklist.length();
+  for (int next = 0; next < non_escaped_length; next++) {
+    JavaObjectNode* jobj = non_escaped_worklist.at(next);
+    if (jobj->escape_state() != PointsToNode::NoEscape ||
+        !jobj->scalar_replaceable() ||
+        !jobj->ideal_node()->is_Allocate()) {
+      continue;
+    }
+    for (UseIterator i(jobj); i.has_next(); i.next()) {
+      PointsToNode* use = i.get();
+      if (use->is_LocalVar() && use->ideal_node()->is_Phi()) {
+        merges.push(use->ideal_node());
+      }
+    }
+  }
+  // Check all candidates before changing the graph since
+  // the checks use Connection Graph information.
+  GrowableArray<PhiNode*> reducible;
+  for (uint next = 0; next < merges.size(); next++) {
+    PhiNode* phi = merges.at(next)->as_Phi();
+    if (can_reduce_merge(phi)) {
+      reducible.append(phi);
+    }
+  }
+  for (int next = 0; next < reducible.length(); next++) {
+    reduce_merge(reducible.at(next));
+  }
+  _reduced_merges = (reducible.length() > 0);
+  return _reduced_merges;
+}
+
+// Returns true if control flows straight from the allocation to 'ctl':
+// it does not pass a merge point or a branch other than an uncommon trap
+// check. Then the allocated object is live only on this path.
+bool ConnectionGraph::is_allocation_path(Node* ctl, AllocateNode* alloc) {
+  while (ctl != NULL && !ctl->is_top()) {
+    if (ctl == alloc) {
+      return true;
+    }
+    if (ctl->is_Region() || ctl->is_Start()) {
+      return false;
+    }
+    if (ctl->is_Proj() && ctl->in(0)->is_MultiBranch()) {
+      // Only the normal return of the allocation itself.
+      if (!ctl->is_CatchProj() ||
+          ctl->as_CatchProj()->_con != CatchProjNode::fall_through_index ||
+          ctl->in(0)->in(0)->in(0) != alloc) {
+        return false;
+      }
+    } else if (ctl->is_Proj() && ctl->in(0)->is_If() &&
+               !ctl->as_Proj()->is_uncommon_trap_if_pattern(Deoptimization::Reason_none)) {
+      return false;
+    }
+    ctl = ctl->in(0);
+  }
+  return false;
+}
+
+// Returns the memory state of the 'alias_idx' slice which flows
+// into 'region' along path 'i' or NULL if it is not known.
+Node* ConnectionGraph::memory_at_region(Node* region, int alias_idx, uint i) {
+  Node* mem = NULL;
+  for (DUIterator_Fast imax, j = region->fast_outs(imax); j < imax; j++) {
+    Node* phi = region->fast_out(j);
+    if (phi->is_Phi() && phi->bottom_type() == Type::MEMORY) {
+      if (phi->adr_type() == TypePtr::BOTTOM) {
+        mem = phi->in(i);
+      } else if (_compile->get_alias_index(phi->adr_type()) == alias_idx) {
+        return phi->in(i);
+      }
+    }
+  }
+  if (mem != NULL && mem->is_MergeMem()) {
+    mem = mem->as_MergeMem()->memory_at(alias_idx);
+  }
+  return mem;
+}
+
+bool ConnectionGraph::can_reduce_merge(PhiNode* phi) {
+  Node* region = phi->region();
+  if (region == NULL || region->is_Loop() || phi->req() < 3) {
+    return false;
+  }
+  // All merged objects should have the same class so that
+  // the merge could be described in debug info.
+  const TypeInstPtr* t = _igvn->type(phi)->isa_instptr();
+  if (t == NULL || !t->klass_is_exact() || t->ptr() != TypePtr::NotNull) {
+    return false;
+  }
+  ciInstanceKlass* ik = t->klass()->as_instance_klass();
+  PointsToNode* ptn = ptnode_adr(phi->_idx);
+  if (ptn == NULL || !ptn->is_LocalVar() ||
+      ptn->edge_count() != (int)(phi->req() - 1) ||
+      memory_at_region(region, Compile::AliasIdxBot, 1) == NULL) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (in == NULL || region->in(i) == NULL || region->in(i)->is_top()) {
+      return false;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(in, _igvn);
+    if (alloc == NULL || alloc->is_AllocateArray() || alloc->result_cast() != in) {
+      return false;
+    }
+    for (uint j = 1; j < i; j++) {
+      if (phi->in(j) == in) {
+        return false;
+      }
+    }
+    PointsToNode* jobj = ptnode_adr(alloc->_idx);
+    if (jobj == NULL || jobj->escape_state() != PointsToNode::NoEscape ||
+        !jobj->scalar_replaceable()) {
+      return false;
+    }
+    // The object should not be stored and all pointers to it
+    // other than the merge should point only to it.
+    for (UseIterator j(jobj); j.has_next(); j.next()) {
+      PointsToNode* use = j.get();
+      if (!use->is_LocalVar() || (use != ptn && use->edge_count() != 1)) {
+        return false;
+      }
+    }
+    // The allocation should not dominate the merge, otherwise
+    // the object could be accessed directly after it.
+    if (!is_allocation_path(region->in(i), alloc)) {
+      return false;
+    }
+  }
+  // The merged object could be only read or referenced from debug info.
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* use = phi->fast_out(i);
+    if (use->is_SafePoint()) {
+      JVMState* jvms = use->as_SafePoint()->jvms();
+      if (jvms == NULL) {
+        return false;
+      }
+      for (uint j = 0; j < use->req(); j++) {
+        if (use->in(j) == phi && (j < jvms->debug_start() || j >= jvms->debug_end())) {
+          return false;
+        }
+      }
+    } else if (use->is_AddP()) {
+      if (use->in(AddPNode::Base) != phi || use->in(AddPNode::Address) != phi) {
+        return false;
+      }
+      intptr_t offset = use->in(AddPNode::Offset)->find_intptr_t_con(Type::OffsetBot);
+      if (offset == Type::OffsetBot || ik->get_field_by_offset((int)offset, false) == NULL) {
+        return false;
+      }
+      for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+        Node* n = use->fast_out(j);
+        if (!n->is_Load() || !n->as_Load()->is_unordered() ||
+            n->in(MemNode::Address) != use) {
+          return false;
+        }
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Create a Phi of the values of 'field' loaded on each path into the merge
+// from the allocation merged on that path. 'proto' is the load from the
+// merged object which is cloned for each path if it is not NULL.
+Node* ConnectionGraph::merged_field_value(Node* region, Node_List& bases, ciField* field, Node* proto) {
+  Compile* C = _compile;
+  PhaseGVN* igvn = _igvn;
+  const TypePtr* adr_type = C->alias_type(field)->adr_type();
+  int alias_idx = C->get_alias_index(adr_type);
+  BasicType bt = field->layout_type();
+  const Type* field_type;
+  if (proto != NULL) {
+    field_type = proto->bottom_type();
+  } else if (bt == T_OBJECT || bt == T_ARRAY) {
+    // The next code is taken from Parse::do_get_xxx().
+    if (!field->type()->is_loaded()) {
+      field_type = TypeInstPtr::BOTTOM;
+    } else {
+      field_type = TypeOopPtr::make_from_klass(field->type()->as_klass());
+    }
+    if (UseCompressedOops) {
+      field_type = field_type->make_narrowoop();
+      bt = T_NARROWOOP;
+    }
+  } else {
+    field_type = Type::get_const_basic_type(bt);
+  }
+  PhiNode* value = new (C) PhiNode(region, field_type);
+  for (uint i = 1; i < region->req(); i++) {
+    Node* base = bases.at(i);
+    Node* ctl  = region->in(i);
+    Node* mem  = memory_at_region(region, alias_idx, i);
+    Node* adr  = igvn->transform(new (C) AddPNode(base, base, igvn->MakeConX(field->offset())));
+    Node* ld;
+    if (proto != NULL) {
+      ld = proto->clone();
+      ld->set_req(MemNode::Control, ctl);
+      ld->set_req(MemNode::Memory,  mem);
+      ld->set_req(MemNode::Address, adr);
+    } else if (bt == T_NARROWOOP) {
+      ld = new (C) LoadNNode(ctl, mem, adr, adr_type, field_type, MemNode::unordered);
+    } else {
+      ld = LoadNode::make(*igvn, ctl, mem, adr, adr_type, field_type, bt, MemNode::unordered);
+    }
+    value->init_req(i, igvn->transform(ld));
+  }
+  return igvn->transform(value);
+}
+
+void ConnectionGraph::reduce_merge(PhiNode* phi) {
+  Compile* C = _compile;
+  PhaseGVN* igvn = _igvn;
+  Node* region = phi->region();
+  const TypeInstPtr* t = _igvn->type(phi)->is_instptr();
+  ciInstanceKlass* ik = t->klass()->as_instance_klass();
+  Node_List bases;
+  for (uint i = 1; i < phi->req(); i++) {
+    bases.map(i, phi->in(i));
+  }
+#ifndef PRODUCT
+  if (PrintReduceAllocationMerges) {
+    tty->print("=== Reduce allocation merge: ");
+    phi->dump();
+  }
+#endif
+
+  Unique_Node_List safepoints;
+  Unique_Node_List loads;
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* use = phi->fast_out(i);
+    if (use->is_SafePoint()) {
+      safepoints.push(use);
+    } else {
+      for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+        loads.push(use->fast_out(j));
+      }
+    }
+  }
+
+  // Describe the merged object in debug info with the merged field values.
+  // It is reallocated on deoptimization.
+  uint nfields = ik->nof_nonstatic_fields();
+  while (safepoints.size() > 0) {
+    SafePointNode* sfpt = safepoints.pop()->as_SafePoint();
+    JVMState* jvms = sfpt->jvms();
+    uint first_ind = (sfpt->req() - jvms->scloff());
+    SafePointScalarObjectNode* sobj = new (C) SafePointScalarObjectNode(t,
+#ifdef ASSERT
+                                                 AllocateNode::Ideal_allocation(bases.at(1), _igvn),
+#endif
+                                                 first_ind, nfields);
+    sobj->init_req(0, C->root());
+    _igvn->register_new_node_with_optimizer(sobj);
+    for (uint j = 0; j < nfields; j++) {
+      Node* field_val = merged_field_value(region, bases, ik->nonstatic_field_at(j), NULL);
+      if (field_val->bottom_type()->isa_narrowoop()) {
+        field_val = igvn->transform(new (C) DecodeNNode(field_val, field_val->get_ptr_type()));
+      }
+      sfpt->add_req(field_val);
+    }
+    jvms->set_endoff(sfpt->req());
+    sfpt->replace_edges_in_range(phi, sobj, jvms->debug_start(), jvms->debug_end());
+    record_for_optimizer(sfpt);
+  }
+  if (phi->outcnt() == 0) {
+    _igvn->remove_dead_node(phi);
+    return;
+  }
+
+  // Replace loads from the merged object. The merge is removed
+  // together with its last load.
+  while (loads.size() > 0) {
+    Node* ld = loads.pop();
+    Node* adr = ld->in(MemNode::Address);
+    intptr_t offset = adr->in(AddPNode::Offset)->find_intptr_t_con(Type::OffsetBot);
+    ciField* field = ik->get_field_by_offset((int)offset, false);
+    _igvn->replace_node(ld, merged_field_value(region, bases, field, ld));
+  }
+}
+
 #ifdef ASSERT
 void ConnectionGraph::verify_connection_graph(
                          GrowableArray<PointsToNode*>&   ptnodes_worklist,
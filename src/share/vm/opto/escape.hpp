@@ -109,16 +109,24 @@
 // is marked GlobalEscape.  Finally, for any node marked ArgEscape, anything
 // it could point to is marked ArgEscape.
 //
+// Since the analysis is flow-insensitive, objects merged by a Phi are not
+// scalar replaceable.  When every object merged by a Phi is a non-escaping
+// allocation which is only live on its own path into the merge, the Phi is
+// split into Phis of the field values loaded on each path
+// (ReduceAllocationMerges) and the graph is built again.
+//
 
 class  Compile;
 class  Node;
 class  CallNode;
+class  AllocateNode;
 class  PhiNode;
 class  PhaseTransform;
 class  PointsToNode;
 class  Type;
 class  TypePtr;
 class  VectorSet;
+class  ciField;
 
 class JavaObjectNode;
 class LocalVarNode;
@@ -333,6 +341,9 @@ private:
 
   bool               _verify;  // verify graph
 
+  bool       _reduced_merges;  // Allocation merges were split, the graph
+                               // has to be rebuilt.
+
   JavaObjectNode* phantom_obj; // Unknown object
   JavaObjectNode*    null_obj;
   Node*             _pcmp_neq; // ConI(#CC_GT)
@@ -456,6 +467,15 @@ private:
   // Adjust scalar_replaceable state after Connection Graph is built.
   void adjust_scalar_replaceable_state(JavaObjectNode* jobj);
 
+  // Split Phis which merge non-escaping allocations into Phis of
+  // the allocations' field values.
+  bool reduce_allocation_merges(GrowableArray<JavaObjectNode*>& non_escaped_worklist);
+  bool can_reduce_merge(PhiNode* phi);
+  void reduce_merge(PhiNode* phi);
+  bool is_allocation_path(Node* ctl, AllocateNode* alloc);
+  Node* memory_at_region(Node* region, int alias_idx, uint i);
+  Node* merged_field_value(Node* region, Node_List& bases, ciField* field, Node* proto);
+
   // Optimize ideal graph.
   void optimize_ideal_graph(GrowableArray<Node*>& ptr_cmp_worklist,
                             GrowableArray<Node*>& storestore_worklist);
@@ -580,7 +600,9 @@ private:
   }
 
   // Compute the escape information
-  bool compute_escape();
+  bool compute_escape(bool reduce_merges);
+
+  bool reduced_merges() const { return _reduced_merges; }
 
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
@@ -763,6 +763,42 @@ bool IdealLoopTree::policy_align( PhaseIdealLoop *phase ) const {
   return false;
 }
 
+//------------------------------policy_vector_post_loop------------------------
+// Return TRUE if the main loop is unrolled exactly to the vector width and
+// is about to be unrolled further.  A copy of it at this point makes a
+// vector post-loop that SuperWord can vectorize, so only the last few
+// iterations are left for the scalar post-loop.
+bool IdealLoopTree::policy_vector_post_loop( PhaseIdealLoop *phase ) const {
+  if (!UseSuperWord || !VectorizedPostLoop) return false;
+  if (!Matcher::misaligned_vectors_ok()) return false;
+
+  CountedLoopNode *cl = _head->as_CountedLoop();
+  if (!cl->is_main_loop() || cl->is_main_no_pre_loop() || cl->has_vector_post_loop()) {
+    return false;
+  }
+  // Only loops SuperWord can handle: no control flow in the body.
+  if (cl->loopexit() == NULL || cl->loopexit()->in(0) != cl) return false;
+
+  // The vector width of the widest vectorizable memory operation.
+  int vlen = 0;
+  for (uint i = 0; i < _body.size(); i++) {
+    Node* n = _body.at(i);
+    if (n->is_Mem()) {
+      BasicType bt = n->as_Mem()->memory_type();
+      if (is_java_primitive(bt)) {
+        vlen = MAX2(vlen, (int)Matcher::max_vector_size(bt));
+      }
+    }
+  }
+  if (vlen < 2 || cl->unrolled_count() != vlen) return false;
+
+  // Check for being too big
+  int nodes_left = phase->C->max_node_limit() - phase->C->live_nodes();
+  if ((int)(3 * _body.size()) > nodes_left) return false;
+
+  return true;
+}
+
 //------------------------------policy_range_check-----------------------------
 // Return TRUE or FALSE if the loop should be range-check-eliminated.
 // Actually we do iteration-splitting, a more powerful form of RCE.
@@ -947,79 +983,8 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
 
   //------------------------------
   // Step A: Create Post-Loop.
-  Node* main_exit = main_end->proj_out(false);
-  assert( main_exit->Opcode() == Op_IfFalse, "" );
-  int dd_main_exit = dom_depth(main_exit);
-
-  // Step A1: Clone the loop body.  The clone becomes the post-loop.  The main
-  // loop pre-header illegally has 2 control users (old & new loops).
-  clone_loop( loop, old_new, dd_main_exit );
-  assert( old_new[main_end ->_idx]->Opcode() == Op_CountedLoopEnd, "" );
-  CountedLoopNode *post_head = old_new[main_head->_idx]->as_CountedLoop();
-  post_head->set_post_loop(main_head);
-
-  // Reduce the post-loop trip count.
-  CountedLoopEndNode* post_end = old_new[main_end ->_idx]->as_CountedLoopEnd();
-  post_end->_prob = PROB_FAIR;
-
-  // Build the main-loop normal exit.
-  IfFalseNode *new_main_exit = new (C) IfFalseNode(main_end);
-  _igvn.register_new_node_with_optimizer( new_main_exit );
-  set_idom(new_main_exit, main_end, dd_main_exit );
-  set_loop(new_main_exit, loop->_parent);
-
-  // Step A2: Build a zero-trip guard for the post-loop.  After leaving the
-  // main-loop, the post-loop may not execute at all.  We 'opaque' the incr
-  // (the main-loop trip-counter exit value) because we will be changing
-  // the exit value (via unrolling) so we cannot constant-fold away the zero
-  // trip guard until all unrolling is done.
-  Node *zer_opaq = new (C) Opaque1Node(C, incr);
-  Node *zer_cmp  = new (C) CmpINode( zer_opaq, limit );
-  Node *zer_bol  = new (C) BoolNode( zer_cmp, b_test );
-  register_new_node( zer_opaq, new_main_exit );
-  register_new_node( zer_cmp , new_main_exit );
-  register_new_node( zer_bol , new_main_exit );
-
-  // Build the IfNode
-  IfNode *zer_iff = new (C) IfNode( new_main_exit, zer_bol, PROB_FAIR, COUNT_UNKNOWN );
-  _igvn.register_new_node_with_optimizer( zer_iff );
-  set_idom(zer_iff, new_main_exit, dd_main_exit);
-  set_loop(zer_iff, loop->_parent);
-
-  // Plug in the false-path, taken if we need to skip post-loop
-  _igvn.replace_input_of(main_exit, 0, zer_iff);
-  set_idom(main_exit, zer_iff, dd_main_exit);
-  set_idom(main_exit->unique_out(), zer_iff, dd_main_exit);
-  // Make the true-path, must enter the post loop
-  Node *zer_taken = new (C) IfTrueNode( zer_iff );
-  _igvn.register_new_node_with_optimizer( zer_taken );
-  set_idom(zer_taken, zer_iff, dd_main_exit);
-  set_loop(zer_taken, loop->_parent);
-  // Plug in the true path
-  _igvn.hash_delete( post_head );
-  post_head->set_req(LoopNode::EntryControl, zer_taken);
-  set_idom(post_head, zer_taken, dd_main_exit);
-
-  Arena *a = Thread::current()->resource_area();
-  VectorSet visited(a);
-  Node_Stack clones(a, main_head->back_control()->outcnt());
-  // Step A3: Make the fall-in values to the post-loop come from the
-  // fall-out values of the main-loop.
-  for (DUIterator_Fast imax, i = main_head->fast_outs(imax); i < imax; i++) {
-    Node* main_phi = main_head->fast_out(i);
-    if( main_phi->is_Phi() && main_phi->in(0) == main_head && main_phi->outcnt() >0 ) {
-      Node *post_phi = old_new[main_phi->_idx];
-      Node *fallmain  = clone_up_backedge_goo(main_head->back_control(),
-                                              post_head->init_control(),
-                                              main_phi->in(LoopNode::LoopBackControl),
-                                              visited, clones);
-      _igvn.hash_delete(post_phi);
-      post_phi->set_req( LoopNode::EntryControl, fallmain );
-    }
-  }
-
-  // Update local caches for next stanza
-  main_exit = new_main_exit;
+  CountedLoopNode *post_head = NULL;
+  insert_post_loop(loop, old_new, main_head, main_end, incr, limit, post_head);
 
 
   //------------------------------
@@ -1076,8 +1041,9 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   main_head->set_req(LoopNode::EntryControl, min_taken);
   set_idom(main_head, min_taken, dd_main_head);
 
-  visited.Clear();
-  clones.clear();
+  Arena *a = Thread::current()->resource_area();
+  VectorSet visited(a);
+  Node_Stack clones(a, main_head->back_control()->outcnt());
   // Step B3: Make the fall-in values to the main-loop come from the
   // fall-out values of the pre-loop.
   for (DUIterator_Fast i2max, i2 = main_head->fast_outs(i2max); i2 < i2max; i2++) {
@@ -1103,12 +1069,8 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // variable value and the induction variable Phi to preserve correct
   // dependencies.
 
-  // CastII for the post loop:
-  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
-  assert(inserted, "no castII inserted");
-
   // CastII for the main loop:
-  inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
+  bool inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
   assert(inserted, "no castII inserted");
 
   // Step B4: Shorten the pre-loop to run only 1 iteration (for now).
@@ -1181,6 +1143,134 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   loop->record_for_igvn();
 }
 
+//------------------------------insert_post_loop-------------------------------
+// Clone the main loop as a post-loop hanging off the main loop's exit,
+// guarded by a zero-trip test against 'limit'.  The fall-in values of the
+// post-loop are the fall-out values of the main loop.  Returns the new
+// normal exit of the main loop.
+Node* PhaseIdealLoop::insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                                        CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                                        Node *incr, Node *limit, CountedLoopNode *&post_head ) {
+  Node* main_exit = main_end->proj_out(false);
+  assert( main_exit->Opcode() == Op_IfFalse, "" );
+  int dd_main_exit = dom_depth(main_exit);
+
+  // Step A1: Clone the loop body.  The clone becomes the post-loop.  The main
+  // loop pre-header illegally has 2 control users (old & new loops).
+  clone_loop( loop, old_new, dd_main_exit );
+  assert( old_new[main_end ->_idx]->Opcode() == Op_CountedLoopEnd, "" );
+  post_head = old_new[main_head->_idx]->as_CountedLoop();
+  post_head->set_normal_loop();
+  post_head->set_post_loop(main_head);
+
+  // Reduce the post-loop trip count.
+  CountedLoopEndNode* post_end = old_new[main_end ->_idx]->as_CountedLoopEnd();
+  post_end->_prob = PROB_FAIR;
+
+  // Build the main-loop normal exit.
+  IfFalseNode *new_main_exit = new (C) IfFalseNode(main_end);
+  _igvn.register_new_node_with_optimizer( new_main_exit );
+  set_idom(new_main_exit, main_end, dd_main_exit );
+  set_loop(new_main_exit, loop->_parent);
+
+  // Step A2: Build a zero-trip guard for the post-loop.  After leaving the
+  // main-loop, the post-loop may not execute at all.  We 'opaque' the incr
+  // (the main-loop trip-counter exit value) because we will be changing
+  // the exit value (via unrolling) so we cannot constant-fold away the zero
+  // trip guard until all unrolling is done.
+  Node *zer_opaq = new (C) Opaque1Node(C, incr);
+  Node *zer_cmp  = new (C) CmpINode( zer_opaq, limit );
+  Node *zer_bol  = new (C) BoolNode( zer_cmp, main_end->test_trip() );
+  register_new_node( zer_opaq, new_main_exit );
+  register_new_node( zer_cmp , new_main_exit );
+  register_new_node( zer_bol , new_main_exit );
+
+  // Build the IfNode
+  IfNode *zer_iff = new (C) IfNode( new_main_exit, zer_bol, PROB_FAIR, COUNT_UNKNOWN );
+  _igvn.register_new_node_with_optimizer( zer_iff );
+  set_idom(zer_iff, new_main_exit, dd_main_exit);
+  set_loop(zer_iff, loop->_parent);
+
+  // Plug in the false-path, taken if we need to skip post-loop
+  _igvn.replace_input_of(main_exit, 0, zer_iff);
+  set_idom(main_exit, zer_iff, dd_main_exit);
+  set_idom(main_exit->unique_out(), zer_iff, dd_main_exit);
+  // Make the true-path, must enter the post loop
+  Node *zer_taken = new (C) IfTrueNode( zer_iff );
+  _igvn.register_new_node_with_optimizer( zer_taken );
+  set_idom(zer_taken, zer_iff, dd_main_exit);
+  set_loop(zer_taken, loop->_parent);
+  // Plug in the true path
+  _igvn.hash_delete( post_head );
+  post_head->set_req(LoopNode::EntryControl, zer_taken);
+  set_idom(post_head, zer_taken, dd_main_exit);
+
+  Arena *a = Thread::current()->resource_area();
+  VectorSet visited(a);
+  Node_Stack clones(a, main_head->back_control()->outcnt());
+  // Step A3: Make the fall-in values to the post-loop come from the
+  // fall-out values of the main-loop.
+  for (DUIterator_Fast imax, i = main_head->fast_outs(imax); i < imax; i++) {
+    Node* main_phi = main_head->fast_out(i);
+    if( main_phi->is_Phi() && main_phi->in(0) == main_head && main_phi->outcnt() >0 ) {
+      Node *post_phi = old_new[main_phi->_idx];
+      Node *fallmain  = clone_up_backedge_goo(main_head->back_control(),
+                                              post_head->init_control(),
+                                              main_phi->in(LoopNode::LoopBackControl),
+                                              visited, clones);
+      _igvn.hash_delete(post_phi);
+      post_phi->set_req( LoopNode::EntryControl, fallmain );
+    }
+  }
+
+  // CastII for the post loop (see insert_pre_post_loops):
+  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
+  assert(inserted, "no castII inserted");
+
+  return new_main_exit;
+}
+
+//------------------------------insert_vector_post_loop------------------------
+// The main loop is about to be unrolled past the vector width.  Keep a
+// copy of it as unrolled so far between the main loop and the scalar
+// post-loop.  SuperWord vectorizes the copy like the main loop, so the
+// iterations left over by the main loop are drained a whole vector at a
+// time and only the last few run in the scalar post-loop.
+void PhaseIdealLoop::insert_vector_post_loop( IdealLoopTree *loop, Node_List &old_new ) {
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("VectorPost   ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+
+  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
+  assert(main_head->is_main_loop() && !main_head->has_vector_post_loop(), "");
+  CountedLoopEndNode *main_end = main_head->loopexit();
+  guarantee(main_end != NULL, "no loop exit node");
+  assert(main_end->outcnt() == 2, "1 true, 1 false path only");
+
+  // Only the copy made at the vector width is useful.
+  main_head->mark_has_vector_post_loop();
+
+  // The zero-trip guard uses the current (vector width) limit of the main
+  // loop, so the copy only runs when a whole vector's worth of iterations
+  // is left.  Later unrolling of the main loop gives it its own limit.
+  CountedLoopNode *post_head = NULL;
+  insert_post_loop(loop, old_new, main_head, main_end, main_end->incr(), main_end->limit(), post_head);
+  post_head->set_vector_post_loop();
+  post_head->set_nonexact_trip_count();
+
+  // The main loop leaves fewer iterations than its unrolled body does,
+  // so the copy runs only once or a few times.
+  post_head->set_profile_trip_cnt(1.0);
+
+  // Unlike a pre-loop, the copy runs after the main loop, so it can not be
+  // used to remove dominated tests from the main body.
+  loop->record_for_igvn();
+}
+
 //------------------------------is_invariant-----------------------------
 // Return true if n is invariant
 bool IdealLoopTree::is_invariant(Node* n) const {
@@ -2240,6 +2330,10 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
       // Partial peel succeeded so terminate this round of loop opts
       return false;
     }
+    if (phase->strip_mine_long_loop(this)) {
+      // The inner loop is made counted by the next round of loop opts
+      return false;
+    }
     if (should_peel) {            // Should we peel?
 #ifndef PRODUCT
       if (PrintOpto) tty->print_cr("should_peel");
@@ -2327,8 +2421,13 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
     // an even number of trips).  If we are peeling, we might enable some RCE
     // and we'd rather unroll the post-RCE'd loop SO... do not unroll if
     // peeling.
-    if (should_unroll && !should_peel)
+    if (should_unroll && !should_peel) {
+      // Keep the loop as unrolled to the vector width for the iterations
+      // left over by the wider unrolled main loop.
+      if (policy_vector_post_loop(phase))
+        phase->insert_vector_post_loop(this, old_new);
       phase->do_unroll(this,old_new, true);
+    }
 
     // Adjust the pre-loop limits to align the main body
     // iterations.
@@ -821,6 +821,231 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   return true;
 }
 
+//------------------------------strip_mine_long_loop---------------------------
+// Convert a loop with a long induction variable into a loop nest:
+//
+//   long iv = init;                   long outer_iv = init;
+//   do {                              do {
+//     ... iv ...             ==>        int inner_limit = min(limit - outer_iv, max_jint - stride);
+//     iv += stride;                     int j = 0;
+//   } while (iv < limit);               do {
+//                                         ... (outer_iv + j) ...
+//                                         j += stride;
+//                                       } while (j < inner_limit);
+//                                       outer_iv += j;
+//                                     } while (outer_iv < limit);
+//
+// The inner loop has an int induction variable which can't overflow so it
+// is converted to a counted loop by the next round of loop opts and range
+// check elimination, unrolling and vectorization apply to it. The inner
+// loop exits no later than the original loop, the original exit test is
+// kept as the outer loop's test. The backedge safepoint is moved to the
+// outer loop.
+bool PhaseIdealLoop::strip_mine_long_loop(IdealLoopTree *loop) {
+  Node *x = loop->_head;
+  if (!StripMineLongLoops || x->Opcode() != Op_Loop || x->req() != 3 ||
+      loop->_irreducible || x->as_Loop()->is_strip_mined_outer_loop()) {
+    return false;
+  }
+  Node *init_control = x->in(LoopNode::EntryControl);
+  Node *back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+  Node *sfpt = NULL;
+  if (back_control->Opcode() == Op_SafePoint) {
+    sfpt = back_control;
+    back_control = sfpt->in(TypeFunc::Control);
+  }
+  uint iftrue_op = back_control->Opcode();
+  if (iftrue_op != Op_IfTrue && iftrue_op != Op_IfFalse) {
+    return false;
+  }
+  Node *iff = back_control->in(0);
+  if (get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode *test = iff->in(1)->as_Bool();
+  BoolTest::mask bt = test->_test._test;
+  if (iftrue_op == Op_IfFalse) {
+    bt = BoolTest(bt).negate();
+  }
+  Node *cmp = test->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+  Node *incr  = cmp->in(1);
+  Node *limit = cmp->in(2);
+  if (!is_member(loop, get_ctrl(incr))) {
+    Node *tmp = incr;
+    incr = limit;
+    limit = tmp;
+    bt = BoolTest(bt).commute();
+  }
+  if (is_member(loop, get_ctrl(limit)) || !is_member(loop, get_ctrl(incr)) ||
+      incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node *xphi   = incr->in(1);
+  Node *stride = incr->in(2);
+  if (!stride->is_Con()) {
+    if (!xphi->is_Con()) {
+      return false;
+    }
+    Node *tmp = xphi;
+    xphi = stride;
+    stride = tmp;
+  }
+  jlong stride_con = stride->get_long();
+  if (stride_con == 0 || stride_con > max_jint / 2 || stride_con < -(max_jint / 2)) {
+    return false;
+  }
+  if (!xphi->is_Phi() || xphi->as_Phi()->region() != x ||
+      xphi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+  PhiNode *phi = xphi->as_Phi();
+  // The inner loop only needs a test which fails no later than the
+  // original one does, so 'ne' and inclusive tests are fine.
+  if (bt == BoolTest::eq ||
+      (stride_con < 0 && (bt == BoolTest::lt || bt == BoolTest::le)) ||
+      (stride_con > 0 && (bt == BoolTest::gt || bt == BoolTest::ge))) {
+    return false;
+  }
+
+  // ---- SUCCESS! Build the loop nest. ----
+  IdealLoopTree *parent = loop->_parent;
+  Node *exit = iff->as_If()->proj_out(iftrue_op == Op_IfTrue ? 0 : 1);
+
+  LoopNode *outer_head = new (C) LoopNode(init_control, C->top());
+  outer_head->mark_strip_mined_outer_loop();
+  register_control(outer_head, parent, init_control);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dom_depth(outer_head) + 1);
+
+  // Every value carried around the loop is carried around
+  // the outer loop too.
+  Node_List phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node *n = x->fast_out(i);
+    if (n->is_Phi() && n->in(0) == x) {
+      phis.push(n);
+    }
+  }
+  Node *outer_iv = NULL;
+  while (phis.size() > 0) {
+    Node *p = phis.pop();
+    Node *outer_phi = p->clone();
+    outer_phi->set_req(0, outer_head);
+    register_new_node(outer_phi, outer_head);
+    _igvn.replace_input_of(p, LoopNode::EntryControl, outer_phi);
+    if (p == phi) {
+      outer_iv = outer_phi;
+    }
+  }
+
+  // Number of iterations left, clamped so the int induction variable
+  // can't overflow. Also zero when the long iv overflowed or the loop
+  // exits after the first iteration.
+  jlong iters_max = max_jint - ABS(stride_con);
+  Node *zero_l = _igvn.longcon(0);
+  Node *max_l  = _igvn.longcon(iters_max);
+  Node *left = (stride_con > 0) ? limit : outer_iv;
+  Node *right = (stride_con > 0) ? outer_iv : limit;
+  Node *iters = new (C) SubLNode(left, right);
+  register_new_node(iters, outer_head);
+  Node *cmp_max = new (C) CmpLNode(iters, max_l);
+  register_new_node(cmp_max, outer_head);
+  Node *bol_max = new (C) BoolNode(cmp_max, BoolTest::gt);
+  register_new_node(bol_max, outer_head);
+  iters = new (C) CMoveLNode(bol_max, iters, max_l, TypeLong::LONG);
+  register_new_node(iters, outer_head);
+  Node *cmp_neg = new (C) CmpLNode(iters, zero_l);
+  register_new_node(cmp_neg, outer_head);
+  Node *bol_neg = new (C) BoolNode(cmp_neg, BoolTest::lt);
+  register_new_node(bol_neg, outer_head);
+  iters = new (C) CMoveLNode(bol_neg, iters, zero_l, TypeLong::LONG);
+  register_new_node(iters, outer_head);
+  Node *cmp_run = new (C) CmpLNode(left, right);
+  register_new_node(cmp_run, outer_head);
+  Node *bol_run = new (C) BoolNode(cmp_run, BoolTest::gt);
+  register_new_node(bol_run, outer_head);
+  iters = new (C) CMoveLNode(bol_run, zero_l, iters, TypeLong::LONG);
+  register_new_node(iters, outer_head);
+  Node *inner_limit = new (C) ConvL2INode(iters);
+  register_new_node(inner_limit, outer_head);
+  inner_limit = new (C) CastIINode(inner_limit, TypeInt::make(0, (jint)iters_max, Type::WidenMin));
+  register_new_node(inner_limit, outer_head);
+  if (stride_con < 0) {
+    inner_limit = new (C) SubINode(_igvn.intcon(0), inner_limit);
+    register_new_node(inner_limit, outer_head);
+  }
+
+  // Inner int induction variable and its exit test.
+  PhiNode *inner_phi = new (C) PhiNode(x, TypeInt::INT);
+  Node *inner_incr = new (C) AddINode(inner_phi, _igvn.intcon((jint)stride_con));
+  inner_phi->init_req(LoopNode::EntryControl, _igvn.intcon(0));
+  inner_phi->init_req(LoopNode::LoopBackControl, inner_incr);
+  register_new_node(inner_phi, x);
+  register_new_node(inner_incr, x);
+  Node *inner_cmp = new (C) CmpINode(inner_incr, inner_limit);
+  register_new_node(inner_cmp, iff->in(0));
+  BoolTest::mask inner_bt = (stride_con > 0) ? BoolTest::lt : BoolTest::gt;
+  if (iftrue_op == Op_IfFalse) {
+    inner_bt = BoolTest(inner_bt).negate();
+  }
+  Node *inner_bol = new (C) BoolNode(inner_cmp, inner_bt);
+  register_new_node(inner_bol, iff->in(0));
+  _igvn.replace_input_of(iff, 1, inner_bol);
+
+  // The long iv is the outer iv plus the inner one.
+  Node *inner_iv = new (C) ConvI2LNode(inner_phi);
+  register_new_node(inner_iv, x);
+  Node *iv = new (C) AddLNode(outer_iv, inner_iv);
+  register_new_node(iv, x);
+  _igvn.replace_node(phi, iv);
+
+  // The original exit test becomes the outer loop's test: the old
+  // exit projection now hangs off it and a new one leaves the inner loop.
+  Node *inner_exit = exit->clone();
+  register_control(inner_exit, parent, iff);
+  float cont_prob = PROB_UNLIKELY_MAG(3);
+  IfNode *outer_iff = new (C) IfNode(inner_exit, test,
+                                     iftrue_op == Op_IfTrue ? cont_prob : 1.0f - cont_prob,
+                                     iff->as_If()->_fcnt);
+  register_control(outer_iff, parent, inner_exit);
+  _igvn.replace_input_of(exit, 0, outer_iff);
+  set_idom(exit, outer_iff, dom_depth(outer_iff) + 1);
+  Node *outer_back = back_control->clone();
+  outer_back->set_req(0, outer_iff);
+  register_control(outer_back, parent, outer_iff);
+  if (sfpt != NULL) {
+    // Keep the safepoint on the outer loop only. It sees the same values
+    // as on the original backedge since the outer test is right after the
+    // inner loop's exit.
+    _igvn.replace_input_of(x, LoopNode::LoopBackControl, back_control);
+    _igvn.replace_input_of(sfpt, TypeFunc::Control, outer_back);
+    set_loop(sfpt, parent);
+    set_idom(sfpt, outer_back, dom_depth(outer_back) + 1);
+    if (loop->_safepts != NULL) {
+      loop->_safepts->yank(sfpt);
+    }
+    loop->_tail = back_control;
+    outer_back = sfpt;
+  }
+  _igvn.replace_input_of(outer_head, LoopNode::LoopBackControl, outer_back);
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("StripMineLong ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+  return true;
+}
+
 //----------------------exact_limit-------------------------------------------
 Node* PhaseIdealLoop::exact_limit( IdealLoopTree *loop ) {
   assert(loop->_head->is_CountedLoop(), "");
@@ -889,7 +1114,7 @@ void CountedLoopNode::dump_spec(outputStream *st) const {
   }
   if (is_pre_loop ()) st->print("pre of N%d" , _main_idx);
   if (is_main_loop()) st->print("main of N%d", _idx);
-  if (is_post_loop()) st->print("post of N%d", _main_idx);
+  if (is_post_loop()) st->print("%spost of N%d", is_vector_post_loop() ? "vector " : "", _main_idx);
 }
 #endif
 
@@ -1942,7 +2167,7 @@ void IdealLoopTree::dump_head( ) const {
 
     if (cl->is_pre_loop ()) tty->print(" pre" );
     if (cl->is_main_loop()) tty->print(" main");
-    if (cl->is_post_loop()) tty->print(" post");
+    if (cl->is_post_loop()) tty->print(cl->is_vector_post_loop() ? " vector post" : " post");
   }
   if (_has_call) tty->print(" has_call");
   if (_has_sfpt) tty->print(" has_sfpt");
@@ -62,7 +62,10 @@ protected:
          HasExactTripCount=8,
          InnerLoop=16,
          PartialPeelLoop=32,
-         PartialPeelFailed=64 };
+         PartialPeelFailed=64,
+         VectorPostLoop=128,
+         HasVectorPostLoop=256,
+         StripMinedOuterLoop=512 };
   char _unswitch_count;
   enum { _unswitch_max=3 };
 
@@ -78,6 +81,9 @@ public:
   int partial_peel_has_failed() const { return _loop_flags & PartialPeelFailed; }
   void mark_partial_peel_failed() { _loop_flags |= PartialPeelFailed; }
 
+  int is_strip_mined_outer_loop() const { return _loop_flags & StripMinedOuterLoop; }
+  void mark_strip_mined_outer_loop() { _loop_flags |= StripMinedOuterLoop; }
+
   int unswitch_max() { return _unswitch_max; }
   int unswitch_count() { return _unswitch_count; }
   void set_unswitch_count(int val) {
@@ -214,6 +220,13 @@ public:
   void set_post_loop (CountedLoopNode *main) { assert(is_normal_loop(),""); _loop_flags |= Post; _main_idx = main->_idx; }
   void set_normal_loop(                    ) { _loop_flags &= ~PreMainPostFlagsMask; }
 
+  // A 'vector post' loop is a copy of the main loop, as unrolled to the
+  // vector width, that runs between the main loop and the scalar post-loop.
+  int is_vector_post_loop() const { return _loop_flags & VectorPostLoop; }
+  void set_vector_post_loop() { assert(is_post_loop(),""); _loop_flags |= VectorPostLoop; }
+  int has_vector_post_loop() const { return _loop_flags & HasVectorPostLoop; }
+  void mark_has_vector_post_loop() { _loop_flags |= HasVectorPostLoop; }
+
   void set_trip_count(uint tc) { _trip_count = tc; }
   uint trip_count()            { return _trip_count; }
 
@@ -472,6 +485,10 @@ public:
   // into longer memory ops, we may want to increase alignment.
   bool policy_align( PhaseIdealLoop *phase ) const;
 
+  // Return TRUE if a vector post-loop should be split off the main loop
+  // before it is unrolled past the vector width.
+  bool policy_vector_post_loop( PhaseIdealLoop *phase ) const;
+
   // Return TRUE if "iff" is a range check.
   bool is_range_check_if(IfNode *iff, PhaseIdealLoop *phase, Invariance& invar) const;
 
@@ -829,6 +846,8 @@ public:
   virtual Node *transform( Node *a_node ) { return 0; }
 
   bool is_counted_loop( Node *x, IdealLoopTree *loop );
+  // Convert a long counted loop into an outer loop with an inner int loop
+  bool strip_mine_long_loop( IdealLoopTree *loop );
 
   Node* exact_limit( IdealLoopTree *loop );
 
@@ -874,6 +893,13 @@ public:
   // Add pre and post loops around the given loop.  These loops are used
   // during RCE, unrolling and aligning loops.
   void insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only );
+  // Clone the main loop as a post-loop guarded against 'limit', return the
+  // new main-loop exit.
+  Node *insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                          CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                          Node *incr, Node *limit, CountedLoopNode *&post_head );
+  // Add a vectorizable copy of the main loop between it and its post-loop.
+  void insert_vector_post_loop( IdealLoopTree *loop, Node_List &old_new );
   // If Node n lives in the back_ctrl block, we clone a private version of n
   // in preheader_ctrl block and return that, otherwise return n.
   Node *clone_up_backedge_goo( Node *back_ctrl, Node *preheader_ctrl, Node *n, VectorSet &visited, Node_Stack &clones );
@@ -2324,6 +2324,18 @@ void Matcher::find_shared( Node *n ) {
         n->del_req(4);
         break;
       }
+      case Op_FmaD:
+      case Op_FmaF:
+      case Op_FmaVD:
+      case Op_FmaVF: {
+        // Restructure into a binary tree for Matching: the addend becomes
+        // the first input so it can be matched as the destination register.
+        Node* pair = new (C) BinaryNode(n->in(1), n->in(2));
+        n->set_req(2, pair);
+        n->set_req(1, n->in(3));
+        n->del_req(3);
+        break;
+      }
       default:
         break;
       }
@@ -397,6 +397,30 @@ const Type *MulHiLNode::Value( PhaseTransform *phase ) const {
   return TypeLong::LONG;
 }
 
+//=============================================================================
+//------------------------------Value------------------------------------------
+const Type *FmaDNode::Value( PhaseTransform *phase ) const {
+  const Type *t1 = phase->type( in(1) );
+  const Type *t2 = phase->type( in(2) );
+  const Type *t3 = phase->type( in(3) );
+  if( t1 == Type::TOP || t2 == Type::TOP || t3 == Type::TOP ) return Type::TOP;
+
+  // Constant folding would need a correctly rounded fma() in the host C
+  // library, which is not guaranteed on every build platform.
+  return Type::DOUBLE;
+}
+
+//------------------------------Value------------------------------------------
+const Type *FmaFNode::Value( PhaseTransform *phase ) const {
+  const Type *t1 = phase->type( in(1) );
+  const Type *t2 = phase->type( in(2) );
+  const Type *t3 = phase->type( in(3) );
+  if( t1 == Type::TOP || t2 == Type::TOP || t3 == Type::TOP ) return Type::TOP;
+
+  // See FmaDNode::Value.
+  return Type::FLOAT;
+}
+
 //=============================================================================
 //------------------------------mul_ring---------------------------------------
 // Supplied function returns the product of the inputs IN THE CURRENT RING.
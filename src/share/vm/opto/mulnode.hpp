@@ -151,6 +151,30 @@ public:
   virtual uint ideal_reg() const { return Op_RegL; }
 };
 
+//------------------------------FmaDNode---------------------------------------
+// Fused multiply-add double: in(1) * in(2) + in(3) with a single rounding.
+// Only created for explicit fma calls, never from an AddD/MulD pair, since
+// the fused result may differ from the separately rounded one.
+class FmaDNode : public Node {
+public:
+  FmaDNode(Node *c, Node *in1, Node *in2, Node *in3) : Node(c, in1, in2, in3) {}
+  virtual int Opcode() const;
+  virtual const Type *Value( PhaseTransform *phase ) const;
+  const Type *bottom_type() const { return Type::DOUBLE; }
+  virtual uint ideal_reg() const { return Op_RegD; }
+};
+
+//------------------------------FmaFNode---------------------------------------
+// Fused multiply-add float: in(1) * in(2) + in(3) with a single rounding.
+class FmaFNode : public Node {
+public:
+  FmaFNode(Node *c, Node *in1, Node *in2, Node *in3) : Node(c, in1, in2, in3) {}
+  virtual int Opcode() const;
+  virtual const Type *Value( PhaseTransform *phase ) const;
+  const Type *bottom_type() const { return Type::FLOAT; }
+  virtual uint ideal_reg() const { return Op_RegF; }
+};
+
 //------------------------------AndINode---------------------------------------
 // Logically AND 2 integers.  Included with the MUL nodes because it inherits
 // all the behavior of multiplication on a ring.
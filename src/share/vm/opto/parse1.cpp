@@ -2221,7 +2221,17 @@ void Parse::add_safepoint() {
 
   // Create a node for the polling address
   if( add_poll_param ) {
-    Node *polladr = ConPNode::make(C, (address)os::get_polling_page());
+    Node *polladr;
+    if (SafepointSynchronize::uses_thread_local_poll()) {
+      // Load the polling word of the current thread; pin it here so the
+      // load is repeated on every trip through a loop.
+      Node* thread = _gvn.transform(new (C) ThreadLocalNode());
+      Node* adr = _gvn.transform(basic_plus_adr(top(), thread, in_bytes(JavaThread::polling_page_offset())));
+      polladr = make_load(control(), adr, TypeRawPtr::BOTTOM, T_ADDRESS, Compile::AliasIdxRaw,
+                          MemNode::unordered, LoadNode::Pinned);
+    } else {
+      polladr = ConPNode::make(C, (address)os::get_polling_page());
+    }
     sfpnt->init_req(TypeFunc::Parms+0, _gvn.transform(polladr));
   }
 
@@ -43,6 +43,8 @@ elapsedTimer Phase::_t_parser;
 elapsedTimer Phase::_t_optimizer;
 elapsedTimer   Phase::_t_escapeAnalysis;
 elapsedTimer     Phase::_t_connectionGraph;
+elapsedTimer   Phase::_t_iterGVN;
+elapsedTimer   Phase::_t_iterGVN2;
 elapsedTimer   Phase::_t_idealLoop;
 elapsedTimer   Phase::_t_ccp;
 elapsedTimer Phase::_t_matcher;
@@ -64,8 +66,6 @@ elapsedTimer Phase::_t_temporaryTimer2;
 elapsedTimer Phase::_t_idealLoopVerify;
 
 // Subtimers for _t_optimizer
-elapsedTimer   Phase::_t_iterGVN;
-elapsedTimer   Phase::_t_iterGVN2;
 elapsedTimer   Phase::_t_incrInline;
 elapsedTimer   Phase::_t_renumberLive;
 
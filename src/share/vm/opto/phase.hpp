@@ -79,6 +79,8 @@ public:
   static elapsedTimer   _t_escapeAnalysis;
   static elapsedTimer     _t_connectionGraph;
 protected:
+  static elapsedTimer   _t_iterGVN;
+  static elapsedTimer   _t_iterGVN2;
   static elapsedTimer   _t_idealLoop;
   static elapsedTimer   _t_ccp;
   static elapsedTimer _t_matcher;
@@ -100,8 +102,6 @@ protected:
   static elapsedTimer _t_idealLoopVerify;
 
 // Subtimers for _t_optimizer
-  static elapsedTimer   _t_iterGVN;
-  static elapsedTimer   _t_iterGVN2;
   static elapsedTimer   _t_incrInline;
   static elapsedTimer   _t_renumberLive;
 
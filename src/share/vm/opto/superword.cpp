@@ -61,6 +61,7 @@ SuperWord::SuperWord(PhaseIdealLoop* phase) :
   _nlist(arena(), 8, 0, NULL),            // scratch list of nodes
   _lpt(NULL),                             // loop tree node
   _lp(NULL),                              // LoopNode
+  _pre_loop_end(NULL),                    // pre loop end of the main loop
   _bb(NULL),                              // basic block
   _iv(NULL)                               // induction var
 {}
@@ -76,7 +77,17 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 
   if (!cl->is_valid_counted_loop()) return; // skip malformed counted loop
 
-  if (!cl->is_main_loop() ) return; // skip normal, pre, and post loops
+  // Skip normal, pre, and post loops, but for the vector post-loop copied
+  // from a main loop.  The vector post-loop is not aligned by a pre-loop
+  // of its own, so it is only vectorized if misaligned vectors are fine.
+  CountedLoopNode *main_head = cl;
+  if (cl->is_vector_post_loop()) {
+    if (!Matcher::misaligned_vectors_ok()) return;
+    main_head = get_main_loop_of_vector_post(cl);
+    if (main_head == NULL) return;
+  } else if (!cl->is_main_loop()) {
+    return;
+  }
 
   // Check for no control flow in body (other than exit)
   Node *cl_exit = cl->loopexit();
@@ -88,7 +99,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
   }
 
   // Check for pre-loop ending with CountedLoopEnd(Bool(Cmp(x,Opaque1(limit))))
-  CountedLoopEndNode* pre_end = get_pre_loop_end(cl);
+  CountedLoopEndNode* pre_end = get_pre_loop_end(main_head);
   if (pre_end == NULL) return;
   Node *pre_opaq1 = pre_end->limit();
   if (pre_opaq1->Opcode() != Op_Opaque1) return;
@@ -97,6 +108,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 
   set_lpt(lpt);
   set_lp(cl);
+  _pre_loop_end = pre_end;
 
   // For now, define one block which is the entire loop body
   set_bb(cl);
@@ -110,6 +122,8 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 //
 // 1) A reverse post-order of nodes in the block is constructed.  By scanning
 //    this list from first to last, all definitions are visited before their uses.
+//    Loop-carried reduction chains (sum += a[i]) are flagged so that their
+//    members may be packed even though each depends on the previous one.
 //
 // 2) A point-to-point dependence graph is constructed between memory references.
 //    This simplies the upcoming "independence" checker.
@@ -146,6 +160,10 @@ void SuperWord::SLP_extract() {
   if (!construct_bb())
     return; // Exit if no interesting nodes or complex graph.
 
+  if (SuperWordReductions) {
+    mark_reductions();
+  }
+
   dependence_graph();
 
   compute_max_depth();
@@ -447,7 +465,7 @@ bool SuperWord::ref_is_alignable(SWPointer& p) {
   if (!p.has_iv()) {
     return true;   // no induction variable
   }
-  CountedLoopEndNode* pre_end = get_pre_loop_end(lp()->as_CountedLoop());
+  CountedLoopEndNode* pre_end = pre_loop_end();
   assert(pre_end != NULL, "we must have a correct pre-loop");
   assert(pre_end->stride_is_con(), "pre loop stride is constant");
   int preloop_stride = pre_end->stride_con();
@@ -680,7 +698,7 @@ bool SuperWord::stmts_can_pack(Node* s1, Node* s2, int align) {
   }
 
   if (isomorphic(s1, s2)) {
-    if (independent(s1, s2)) {
+    if (independent(s1, s2) || reduction(s1, s2)) {
       if (!exists_at(s1, 0) && !exists_at(s2, 1)) {
         if (!s1->is_Mem() || are_adjacent_refs(s1, s2)) {
           int s1_align = alignment(s1);
@@ -779,6 +797,91 @@ bool SuperWord::independent_path(Node* shallow, Node* deep, uint dp) {
   return true;
 }
 
+//------------------------------reduction---------------------------
+// Is s1 immediately before s2 in a reduction chain, so that s2
+// accumulates into the value produced by s1?
+bool SuperWord::reduction(Node* s1, Node* s2) {
+  if (!s1->is_reduction() || !s2->is_reduction()) return false;
+  return s2->in(1) == s1;
+}
+
+//------------------------------mark_reductions---------------------------
+// Flag the nodes of loop-carried reduction chains.  In the unrolled body
+// such a chain starts at a loop head Phi, goes through one node with the
+// same opcode per original iteration, each used only by the next one, and
+// its last node flows back into the Phi (and possibly out of the loop).
+// The accumulated value is moved to in(1) of every chain node so that the
+// other operand can be packed with its neighbours.
+void SuperWord::mark_reductions() {
+  for (DUIterator_Fast imax, i = lp()->fast_outs(imax); i < imax; i++) {
+    Node* phi = lp()->fast_out(i);
+    if (!phi->is_Phi() || phi == iv() || !in_bb(phi) || phi->outcnt() != 1) {
+      continue;
+    }
+    Node* last = phi->in(LoopNode::LoopBackControl);
+    if (last == NULL || !in_bb(last)) {
+      continue;
+    }
+    int opc = last->Opcode();
+    if (ReductionNode::opcode(opc, phi->bottom_type()->basic_type()) == opc) {
+      continue; // Not an operation we can reduce.
+    }
+
+    // Follow the chain from the Phi to the node feeding the backedge.
+    int len = 0;
+    Node* n = phi;
+    while (n != last) {
+      if (n->outcnt() != 1) break;
+      Node* use = n->unique_out();
+      if (use->Opcode() != opc || !in_bb(use)) break;
+      n = use;
+      len++;
+    }
+    if (n != last || len < 2) {
+      continue;
+    }
+
+    // The last node may only be used by the Phi and after the loop.
+    bool ok = true;
+    for (DUIterator_Fast jmax, j = last->fast_outs(jmax); j < jmax; j++) {
+      Node* use = last->fast_out(j);
+      if (use != phi && _phase->is_member(lpt(), _phase->ctrl_or_self(use))) {
+        ok = false;
+        break;
+      }
+    }
+    if (!ok) {
+      continue;
+    }
+
+    Node* prev = phi;
+    for (n = phi->unique_out(); ; prev = n, n = n->unique_out()) {
+      if (n->in(2) == prev) {
+        n->swap_edges(1, 2); // All reduction operations are commutative.
+      }
+      n->add_flag(Node::Flag_is_reduction);
+      if (n == last) break;
+    }
+  }
+}
+
+//------------------------------reduction_trip_count_profitable---------------------------
+// The horizontal part of a reduction is executed in every iteration of
+// the vectorized main loop.  It only pays off if the main loop is expected
+// to run at least a couple of times; otherwise the pre- and post-loops do
+// the work anyway and the vector loop only adds code.
+bool SuperWord::reduction_trip_count_profitable() {
+  CountedLoopNode* cl = lp()->as_CountedLoop();
+  if (cl->is_vector_post_loop()) {
+    return true; // Runs at most a few times but replaces a scalar post-loop
+  }
+  if (cl->has_exact_trip_count()) {
+    return cl->trip_count() >= 2; // Iterations of the unrolled main loop
+  }
+  float trip_cnt = cl->profile_trip_cnt();
+  return trip_cnt == COUNT_UNKNOWN || trip_cnt >= 2.0f * cl->unrolled_count();
+}
+
 //------------------------------set_alignment---------------------------
 void SuperWord::set_alignment(Node* s1, Node* s2, int align) {
   set_alignment(s1, align);
@@ -1108,6 +1211,12 @@ void SuperWord::filter_packs() {
 // Can code be generated for pack p?
 bool SuperWord::implemented(Node_List* p) {
   Node* p0 = p->at(0);
+  if (p0->is_reduction()) {
+    BasicType bt = velt_basic_type(p0);
+    // Folding two int lanes is not cheaper than the scalar operations.
+    if (bt == T_INT && p->size() < 4) return false;
+    return ReductionNode::implemented(p0->Opcode(), p->size(), bt);
+  }
   return VectorNode::implemented(p0->Opcode(), p->size(), velt_basic_type(p0));
 }
 
@@ -1142,6 +1251,16 @@ bool SuperWord::profitable(Node_List* p) {
     if (!is_vector_use(p0, i))
       return false;
   }
+  if (p0->is_reduction()) {
+    // The lanes folded into the accumulator must come from a vector of
+    // the same shape, not from a promoted scalar.
+    Node_List* second_pk = my_pack(p0->in(2));
+    if (second_pk == NULL || second_pk->size() != p->size() ||
+        velt_basic_type(second_pk->at(0)) != velt_basic_type(p0))
+      return false;
+    if (!reduction_trip_count_profitable())
+      return false;
+  }
   if (VectorNode::is_shift(p0)) {
     // For now, return false if shift count is vector or not scalar promotion
     // case (different shift counts) because it is not supported yet.
@@ -1395,8 +1514,14 @@ void SuperWord::output() {
 
   // MUST ENSURE main loop's initial value is properly aligned:
   //  (iv_initial_value + min_iv_offset) % vector_width_in_bytes() == 0
-
-  align_initial_loop_index(align_to_ref());
+  //
+  // Unless misaligned vectors are fine and the loop is too short for
+  // the alignment iterations to pay off: the pre-loop then keeps its
+  // single iteration.  The vector post-loop starts wherever the main
+  // loop stopped and has no pre-loop of its own to adjust.
+  if (!lp()->as_CountedLoop()->is_vector_post_loop() && !skip_alignment()) {
+    align_initial_loop_index(align_to_ref());
+  }
 
   // Insert extract (unpack) operations for scalar uses
   for (int i = 0; i < _packset.length(); i++) {
@@ -1445,6 +1570,23 @@ void SuperWord::output() {
         const TypePtr* atyp = n->adr_type();
         vn = StoreVectorNode::make(C, opc, ctl, mem, adr, atyp, val, vlen);
         vlen_in_bytes = vn->as_StoreVector()->memory_size();
+      } else if (n->is_reduction()) {
+        // Fold the lanes of the vector operand into the scalar accumulator
+        Node* in1 = low_adr->in(1);
+        Node* in2 = vector_opd(p, 2);
+        vn = ReductionNode::make(C, opc, NULL, in1, in2, velt_basic_type(n));
+        if (in2->is_LoadVector()) {
+          vlen_in_bytes = in2->as_LoadVector()->memory_size();
+        } else {
+          vlen_in_bytes = in2->as_Vector()->length_in_bytes();
+        }
+      } else if (opc == Op_FmaD || opc == Op_FmaF) {
+        // Promote operands to vector
+        Node* in1 = vector_opd(p, 1);
+        Node* in2 = vector_opd(p, 2);
+        Node* in3 = vector_opd(p, 3);
+        vn = VectorNode::make(C, opc, in1, in2, in3, vlen, velt_basic_type(n));
+        vlen_in_bytes = vn->as_Vector()->length_in_bytes();
       } else if (n->req() == 3) {
         // Promote operands to vector
         Node* in1 = vector_opd(p, 1);
@@ -1614,9 +1756,20 @@ void SuperWord::insert_extracts(Node_List* p) {
 //------------------------------is_vector_use---------------------------
 // Is use->in(u_idx) a vector use?
 bool SuperWord::is_vector_use(Node* use, int u_idx) {
+  Node* def = use->in(u_idx);
+  if (def->is_reduction() && my_pack(def) != NULL) {
+    // A packed reduction produces the scalar result of the whole chain,
+    // which is what the loop head Phi and the uses after the loop expect.
+    if ((use->is_Phi() && use->in(0) == lp()) ||
+        !_phase->is_member(lpt(), _phase->ctrl_or_self(use)))
+      return true;
+  }
   Node_List* u_pk = my_pack(use);
   if (u_pk == NULL) return false;
-  Node* def = use->in(u_idx);
+  if (use->is_reduction() && u_idx == 1) {
+    // The accumulator is the Phi or the result of the preceding reduction.
+    return def->is_Phi() || def->is_reduction();
+  }
   Node_List* d_pk = my_pack(def);
   if (d_pk == NULL) {
     // check for scalar promotion
@@ -2052,8 +2205,8 @@ LoadNode::ControlDependency SuperWord::control_dependency(Node_List* p) {
 void SuperWord::align_initial_loop_index(MemNode* align_to_ref) {
   CountedLoopNode *main_head = lp()->as_CountedLoop();
   assert(main_head->is_main_loop(), "");
-  CountedLoopEndNode* pre_end = get_pre_loop_end(main_head);
-  assert(pre_end != NULL, "we must have a correct pre-loop");
+  CountedLoopEndNode* pre_end = pre_loop_end();
+  assert(pre_end != NULL && pre_end == get_pre_loop_end(main_head), "we must have a correct pre-loop");
   Node *pre_opaq1 = pre_end->limit();
   assert(pre_opaq1->Opcode() == Op_Opaque1, "");
   Opaque1Node *pre_opaq = (Opaque1Node*)pre_opaq1;
@@ -2206,6 +2359,23 @@ void SuperWord::align_initial_loop_index(MemNode* align_to_ref) {
   pre_opaq->set_req(1, constrained);
 }
 
+//----------------------------skip_alignment---------------------------
+// With misaligned vectors allowed, aligning the main loop only makes the
+// vector accesses faster; it costs up to a vector's worth of scalar
+// pre-loop iterations.  Don't pay that for loops profiled to run only a
+// few times through the unrolled body.
+bool SuperWord::skip_alignment() {
+  if (!VectorizedPostLoop || !Matcher::misaligned_vectors_ok()) {
+    return false;
+  }
+  CountedLoopNode* cl = lp()->as_CountedLoop();
+  if (cl->has_exact_trip_count()) {
+    return cl->trip_count() < 4;
+  }
+  float trip_cnt = cl->profile_trip_cnt();
+  return trip_cnt != COUNT_UNKNOWN && trip_cnt < 4.0f * cl->unrolled_count();
+}
+
 //----------------------------get_pre_loop_end---------------------------
 // Find pre loop end from main loop.  Returns null if none.
 CountedLoopEndNode* SuperWord::get_pre_loop_end(CountedLoopNode* cl) {
@@ -2224,6 +2394,25 @@ CountedLoopEndNode* SuperWord::get_pre_loop_end(CountedLoopNode* cl) {
   return pre_end;
 }
 
+//----------------------------get_main_loop_of_vector_post---------------------------
+// Walk up the dominator tree from the vector post-loop entry to the exit
+// of the main loop it was copied from.  Returns null if none.
+CountedLoopNode* SuperWord::get_main_loop_of_vector_post(CountedLoopNode* cl) {
+  assert(cl->is_vector_post_loop(), "");
+  Node* ctrl = cl->in(LoopNode::EntryControl);
+  for (int i = 0; i < 10 && ctrl != NULL && !ctrl->is_top(); i++) {
+    if (ctrl->is_CountedLoopEnd()) {
+      CountedLoopNode* main_head = ctrl->as_CountedLoopEnd()->loopnode();
+      if (main_head != NULL && main_head->_idx == (uint)cl->main_idx() && main_head->is_main_loop()) {
+        return main_head;
+      }
+      return NULL;
+    }
+    ctrl = _phase->idom(ctrl);
+  }
+  return NULL;
+}
+
 
 //------------------------------init---------------------------
 void SuperWord::init() {
@@ -2238,6 +2427,7 @@ void SuperWord::init() {
   _align_to_ref = NULL;
   _lpt = NULL;
   _lp = NULL;
+  _pre_loop_end = NULL;
   _bb = NULL;
   _iv = NULL;
 }
@@ -273,6 +273,7 @@ class SuperWord : public ResourceObj {
  private:
   IdealLoopTree* _lpt;             // Current loop tree node
   LoopNode*      _lp;              // Current LoopNode
+  CountedLoopEndNode* _pre_loop_end; // Pre-loop end of the current main loop
   Node*          _bb;              // Current basic block
   PhiNode*       _iv;              // Induction var
 
@@ -289,6 +290,8 @@ class SuperWord : public ResourceObj {
                                      _iv = lp->as_CountedLoop()->phi()->as_Phi(); }
   int      iv_stride()             { return lp()->as_CountedLoop()->stride_con(); }
 
+  CountedLoopEndNode* pre_loop_end() { return _pre_loop_end; }
+
   int vector_width(Node* n) {
     BasicType bt = velt_basic_type(n);
     return MIN2(ABS(iv_stride()), Matcher::max_vector_size(bt));
@@ -363,6 +366,12 @@ class SuperWord : public ResourceObj {
   bool isomorphic(Node* s1, Node* s2);
   // Is there no data path from s1 to s2 or s2 to s1?
   bool independent(Node* s1, Node* s2);
+  // Is s1 the immediate reduction input of s2?
+  bool reduction(Node* s1, Node* s2);
+  // Flag the loop-carried reduction chains in the block
+  void mark_reductions();
+  // Is the main loop expected to run long enough to amortize its reductions?
+  bool reduction_trip_count_profitable();
   // Helper for independent
   bool independent_path(Node* shallow, Node* deep, uint dp=0);
   void set_alignment(Node* s1, Node* s2, int align);
@@ -434,8 +443,12 @@ class SuperWord : public ResourceObj {
   // Adjust pre-loop limit so that in main loop, a load/store reference
   // to align_to_ref will be a position zero in the vector.
   void align_initial_loop_index(MemNode* align_to_ref);
+  // Is the main loop too short for the alignment iterations to pay off?
+  bool skip_alignment();
   // Find pre loop end from main loop.  Returns null if none.
   CountedLoopEndNode* get_pre_loop_end(CountedLoopNode *cl);
+  // Find the main loop a vector post-loop was copied from.  Returns null if none.
+  CountedLoopNode* get_main_loop_of_vector_post(CountedLoopNode *cl);
   // Is the use of d1 in u1 at the same operand position as d2 in u2?
   bool opnd_positions_match(Node* d1, Node* u1, Node* d2, Node* u2);
   void init();
@@ -89,6 +89,12 @@ int VectorNode::opcode(int sopc, BasicType bt) {
   case Op_DivD:
     assert(bt == T_DOUBLE, "must be");
     return Op_DivVD;
+  case Op_FmaD:
+    assert(bt == T_DOUBLE, "must be");
+    return Op_FmaVD;
+  case Op_FmaF:
+    assert(bt == T_FLOAT, "must be");
+    return Op_FmaVF;
   case Op_LShiftI:
     switch (bt) {
     case T_BOOLEAN:
@@ -298,6 +304,21 @@ VectorNode* VectorNode::make(Compile* C, int opc, Node* n1, Node* n2, uint vlen,
 
 }
 
+// Return the vector version of a scalar ternary operation node.
+VectorNode* VectorNode::make(Compile* C, int opc, Node* n1, Node* n2, Node* n3, uint vlen, BasicType bt) {
+  const TypeVect* vt = TypeVect::make(bt, vlen);
+  int vopc = VectorNode::opcode(opc, bt);
+  // This method should not be called for unimplemented vectors.
+  guarantee(vopc > 0, err_msg_res("Vector for '%s' is not implemented", NodeClassNames[opc]));
+
+  switch (vopc) {
+  case Op_FmaVD: return new (C) FmaVDNode(n1, n2, n3, vt);
+  case Op_FmaVF: return new (C) FmaVFNode(n1, n2, n3, vt);
+  }
+  fatal(err_msg_res("Missed vector creation for '%s'", NodeClassNames[vopc]));
+  return NULL;
+}
+
 // Scalar promotion
 VectorNode* VectorNode::scalar2vector(Compile* C, Node* s, uint vlen, const Type* opd_t) {
   BasicType bt = opd_t->array_element_basic_type();
@@ -341,6 +362,67 @@ VectorNode* VectorNode::shift_count(Compile* C, Node* shift, Node* cnt, uint vle
   return NULL;
 }
 
+// Return the reduction operator for the specified scalar operation.
+// Returns opc itself if there is no reduction for that operation and type.
+int ReductionNode::opcode(int opc, BasicType bt) {
+  switch (opc) {
+  case Op_AddI: if (bt == T_INT)    return Op_AddReductionVI; break;
+  case Op_AddL: if (bt == T_LONG)   return Op_AddReductionVL; break;
+  case Op_AddF: if (bt == T_FLOAT)  return Op_AddReductionVF; break;
+  case Op_AddD: if (bt == T_DOUBLE) return Op_AddReductionVD; break;
+  case Op_MulI: if (bt == T_INT)    return Op_MulReductionVI; break;
+  case Op_MulF: if (bt == T_FLOAT)  return Op_MulReductionVF; break;
+  case Op_MulD: if (bt == T_DOUBLE) return Op_MulReductionVD; break;
+  case Op_MinI: if (bt == T_INT)    return Op_MinReductionVI; break;
+  case Op_MaxI: if (bt == T_INT)    return Op_MaxReductionVI; break;
+  case Op_AndI: if (bt == T_INT)    return Op_AndReductionVI; break;
+  case Op_AndL: if (bt == T_LONG)   return Op_AndReductionVL; break;
+  case Op_OrI:  if (bt == T_INT)    return Op_OrReductionVI;  break;
+  case Op_OrL:  if (bt == T_LONG)   return Op_OrReductionVL;  break;
+  case Op_XorI: if (bt == T_INT)    return Op_XorReductionVI; break;
+  case Op_XorL: if (bt == T_LONG)   return Op_XorReductionVL; break;
+  }
+  return opc; // Unimplemented
+}
+
+// Return the appropriate reduction node.
+ReductionNode* ReductionNode::make(Compile* C, int opc, Node* ctrl, Node* n1, Node* n2, BasicType bt) {
+  int vopc = opcode(opc, bt);
+
+  // This method should not be called for unimplemented vectors.
+  guarantee(vopc != opc, err_msg_res("Vector for '%s' is not implemented", NodeClassNames[opc]));
+
+  switch (vopc) {
+  case Op_AddReductionVI: return new (C) AddReductionVINode(ctrl, n1, n2);
+  case Op_AddReductionVL: return new (C) AddReductionVLNode(ctrl, n1, n2);
+  case Op_AddReductionVF: return new (C) AddReductionVFNode(ctrl, n1, n2);
+  case Op_AddReductionVD: return new (C) AddReductionVDNode(ctrl, n1, n2);
+  case Op_MulReductionVI: return new (C) MulReductionVINode(ctrl, n1, n2);
+  case Op_MulReductionVF: return new (C) MulReductionVFNode(ctrl, n1, n2);
+  case Op_MulReductionVD: return new (C) MulReductionVDNode(ctrl, n1, n2);
+  case Op_MinReductionVI: return new (C) MinReductionVINode(ctrl, n1, n2);
+  case Op_MaxReductionVI: return new (C) MaxReductionVINode(ctrl, n1, n2);
+  case Op_AndReductionVI: return new (C) AndReductionVINode(ctrl, n1, n2);
+  case Op_AndReductionVL: return new (C) AndReductionVLNode(ctrl, n1, n2);
+  case Op_OrReductionVI:  return new (C) OrReductionVINode (ctrl, n1, n2);
+  case Op_OrReductionVL:  return new (C) OrReductionVLNode (ctrl, n1, n2);
+  case Op_XorReductionVI: return new (C) XorReductionVINode(ctrl, n1, n2);
+  case Op_XorReductionVL: return new (C) XorReductionVLNode(ctrl, n1, n2);
+  }
+  fatal(err_msg_res("Missed vector creation for '%s'", NodeClassNames[vopc]));
+  return NULL;
+}
+
+bool ReductionNode::implemented(int opc, uint vlen, BasicType bt) {
+  if (is_java_primitive(bt) &&
+      (vlen > 1) && is_power_of_2(vlen) &&
+      Matcher::vector_size_supported(bt, vlen)) {
+    int vopc = ReductionNode::opcode(opc, bt);
+    return vopc != opc && Matcher::match_rule_supported(vopc);
+  }
+  return false;
+}
+
 // Return initial Pack node. Additional operands added with add_opd() calls.
 PackNode* PackNode::make(Compile* C, Node* s, uint vlen, BasicType bt) {
   const TypeVect* vt = TypeVect::make(bt, vlen);
@@ -2156,6 +2156,12 @@ void check_gclog_consistency() {
     jio_fprintf(defaultStream::output_stream(),
                 "GCLogFileSize changed to minimum 8K\n");
   }
+
+  if (AsyncGCLogging && AsyncLogBufferSize < 8*K) {
+    FLAG_SET_CMDLINE(uintx, AsyncLogBufferSize, 8*K);
+    jio_fprintf(defaultStream::output_stream(),
+                "AsyncLogBufferSize changed to minimum 8K\n");
+  }
 }
 
 // This function is called for -Xloggc:<filename>, it can be used
@@ -2349,6 +2355,23 @@ bool Arguments::check_vm_args_consistency() {
   status = status && verify_interval(SymbolTableSize, minimumSymbolTableSize,
     (max_uintx / SymbolTable::bucket_size()), "SymbolTable size");
 
+  status = status && verify_interval(HeapDumpGzipLevel, 0, 9, "HeapDumpGzipLevel");
+
+  // A zero interval would turn the service thread's timed wait into an
+  // untimed one.
+  status = status && verify_min_value(AsyncDeflationInterval, 1, "AsyncDeflationInterval");
+
+  if (AsyncDeflateIdleMonitors) {
+    // The service thread scans the monitor blocks; per-thread in-use
+    // lists would only hold on to monitors it has already deflated.
+    if (MonitorInUseLists) {
+      if (!FLAG_IS_DEFAULT(MonitorInUseLists)) {
+        warning("MonitorInUseLists is disabled by AsyncDeflateIdleMonitors");
+      }
+      FLAG_SET_DEFAULT(MonitorInUseLists, false);
+    }
+  }
+
   {
     // Using "else if" below to avoid printing two error messages if min > max.
     // This will also prevent us from reporting both min>100 and max>100 at the
@@ -2397,6 +2420,8 @@ bool Arguments::check_vm_args_consistency() {
 
   status = status && verify_percentage(GCHeapFreeLimit, "GCHeapFreeLimit");
   status = status && verify_percentage(GCTimeLimit, "GCTimeLimit");
+  status = status && verify_interval(ParallelOldIncrementalReclaimPercent, 1, 100,
+                                     "ParallelOldIncrementalReclaimPercent");
   if (GCTimeLimit == 100) {
     // Turn off gc-overhead-limit-exceeded checks
     FLAG_SET_DEFAULT(UseGCOverheadLimit, false);
@@ -2483,6 +2508,8 @@ bool Arguments::check_vm_args_consistency() {
                                        "G1ConcRSLogCacheSize");
     status = status && verify_interval(StringDeduplicationAgeThreshold, 1, markOopDesc::max_age,
                                        "StringDeduplicationAgeThreshold");
+    status = status && verify_min_value((intx)StringDeduplicationThreads, 1,
+                                        "StringDeduplicationThreads");
   }
   if (UseConcMarkSweepGC) {
     status = status && verify_min_value(CMSOldPLABNumRefills, 1, "CMSOldPLABNumRefills");
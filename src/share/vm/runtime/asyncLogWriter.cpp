@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/asyncLogWriter.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+
+AsyncLogBuffer::AsyncLogBuffer(size_t capacity) :
+  _capacity(capacity), _head(0), _tail(0), _draining(0), _dropped(0), _reported(0) {
+  assert(is_power_of_2(capacity), "must be a power of 2");
+  _base = NEW_C_HEAP_ARRAY(char, capacity, mtInternal);
+  memset(_base, 0, capacity);
+}
+
+bool AsyncLogBuffer::enqueue(outputStream* target, const char* s, size_t len) {
+  intptr_t size = (intptr_t)align_size_up(sizeof(Record) + len, BytesPerLong);
+  if ((size_t)size > _capacity / 2) {
+    Atomic::inc(&_dropped);
+    return false;
+  }
+
+  // Claim the space for the record, plus padding if it would otherwise
+  // wrap around the end of the buffer.
+  intptr_t head;
+  intptr_t pad;
+  while (true) {
+    head = _head;
+    intptr_t pos = head & (_capacity - 1);
+    pad = (pos + size > (intptr_t)_capacity) ? (intptr_t)_capacity - pos : 0;
+    if (head + pad + size - OrderAccess::load_ptr_acquire(&_tail) > (intptr_t)_capacity) {
+      Atomic::inc(&_dropped);
+      return false;
+    }
+    if (Atomic::cmpxchg_ptr(head + pad + size, &_head, head) == head) {
+      break;
+    }
+  }
+
+  if (pad > 0) {
+    OrderAccess::release_store_ptr(&record_at(head)->_size, -pad);
+  }
+  Record* r = record_at(head + pad);
+  r->_target = target;
+  r->_length = len;
+  memcpy((char*)(r + 1), s, len);
+  OrderAccess::release_store_ptr(&r->_size, size);
+  return true;
+}
+
+bool AsyncLogBuffer::lock(bool wait) {
+  while (Atomic::cmpxchg(1, &_draining, 0) != 0) {
+    if (!wait) {
+      return false;
+    }
+    os::naked_short_sleep(1);
+  }
+  return true;
+}
+
+void AsyncLogBuffer::unlock() {
+  OrderAccess::release_store(&_draining, 0);
+}
+
+bool AsyncLogBuffer::drain(bool wait) {
+  if (!lock(wait)) {
+    return false;
+  }
+  write_out();
+  unlock();
+  return true;
+}
+
+void AsyncLogBuffer::write_out() {
+  assert(_draining != 0, "must hold the consumer side");
+  outputStream* last = NULL;
+  intptr_t tail = _tail;
+  while (true) {
+    Record* r = record_at(tail);
+    intptr_t size = OrderAccess::load_ptr_acquire(&r->_size);
+    if (size == 0) {
+      break;
+    }
+    if (size > 0) {
+      outputStream* target = r->_target;
+      if (last != NULL && last != target) {
+        last->flush();
+      }
+      last = target;
+      jint dropped = _dropped;
+      if (dropped != _reported) {
+        target->print_cr("[AsyncGCLogging: %d messages dropped]", dropped - _reported);
+        _reported = dropped;
+      }
+      target->write((const char*)(r + 1), r->_length);
+    } else {
+      size = -size;
+    }
+    memset((void*)r, 0, size);
+    tail += size;
+    OrderAccess::release_store_ptr(&_tail, tail);
+  }
+  if (last != NULL) {
+    last->flush();
+  }
+}
+
+AsyncLogWriter* AsyncLogWriter::_writer           = NULL;
+AsyncLogBuffer* AsyncLogWriter::_buffer           = NULL;
+outputStream*   AsyncLogWriter::_tty              = NULL;
+volatile jint   AsyncLogWriter::_enabled          = 0;
+volatile bool   AsyncLogWriter::_should_terminate = false;
+
+AsyncLogWriter::AsyncLogWriter() : NamedThread(), _wakeup(0), _waiting(0) {
+  set_name("Async Log Writer");
+}
+
+void AsyncLogWriter::initialize() {
+  if (!AsyncGCLogging) {
+    return;
+  }
+  _buffer = new AsyncLogBuffer((size_t)1 << log2_intptr(AsyncLogBufferSize));
+
+  AsyncLogWriter* writer = new AsyncLogWriter();
+  if (!os::create_thread(writer, os::watcher_thread)) {
+    warning("Failed to create the async log writer thread, "
+            "GC logging stays synchronous");
+    delete writer;
+    return;
+  }
+  _writer = writer;
+  _tty = new(ResourceObj::C_HEAP, mtInternal) asyncLogStream(tty);
+  gclog_or_tty = new(ResourceObj::C_HEAP, mtInternal) asyncLogStream(gclog_or_tty);
+  OrderAccess::release_store(&_enabled, 1);
+  os::start_thread(writer);
+}
+
+void AsyncLogWriter::run() {
+  this->record_stack_base_and_size();
+  this->initialize_thread_local_storage();
+  this->set_native_thread_name(this->name());
+
+  while (!_should_terminate) {
+    _buffer->drain(true /* wait */);
+
+    // Announce that we are about to sleep and check again, so that a
+    // message published in between does not wait for the next one.
+    OrderAccess::release_store(&_waiting, 1);
+    OrderAccess::fence();
+    if (_buffer->is_empty() && !_should_terminate) {
+      _wakeup.wait();
+    } else {
+      // If a producer cleared the flag first, its signal will only cause
+      // one extra pass through the loop. Back off briefly in case the
+      // pending record is still being copied.
+      Atomic::cmpxchg(0, &_waiting, 1);
+      os::naked_short_sleep(1);
+    }
+  }
+  _buffer->drain(true /* wait */);
+
+  // Signal that it is terminated
+  {
+    MutexLockerEx mu(Terminator_lock, Mutex::_no_safepoint_check_flag);
+    _writer = NULL;
+    Terminator_lock->notify_all();
+  }
+
+  // Thread destructor usually does this..
+  ThreadLocalStorage::set_thread(NULL);
+}
+
+void AsyncLogWriter::stop() {
+  if (_writer == NULL) {
+    return;
+  }
+  // New output goes straight to its stream from here on.
+  OrderAccess::release_store(&_enabled, 0);
+  _should_terminate = true;
+  OrderAccess::fence();
+  _writer->_wakeup.signal();
+
+  {
+    MutexLocker mu(Terminator_lock);
+    while (_writer != NULL) {
+      Terminator_lock->wait();
+    }
+  }
+  // Pick up messages that were queued while the writer was exiting.
+  _buffer->drain(true /* wait */);
+
+  // The wrapper is left in place for threads that may still hold it; it
+  // writes synchronously now that the writer is disabled.
+  gclog_or_tty = ((asyncLogStream*)gclog_or_tty)->target();
+}
+
+bool AsyncLogWriter::enqueue(outputStream* target, const char* s, size_t len) {
+  if (OrderAccess::load_acquire(&_enabled) == 0) {
+    return false;
+  }
+  AsyncLogWriter* writer = _writer;
+  if (writer == NULL || ThreadLocalStorage::thread() == writer) {
+    return false;
+  }
+  if (_buffer->enqueue(target, s, len) && writer->_waiting != 0 &&
+      Atomic::cmpxchg(0, &writer->_waiting, 1) == 1) {
+    writer->_wakeup.signal();
+  }
+  // Dropped messages are accounted for by the buffer.
+  return true;
+}
+
+void AsyncLogWriter::flush(bool wait) {
+  if (_buffer != NULL) {
+    _buffer->drain(wait);
+  }
+}
+
+void AsyncLogWriter::lock_output() {
+  if (_buffer != NULL) {
+    _buffer->lock(true /* wait */);
+  }
+}
+
+void AsyncLogWriter::unlock_output() {
+  if (_buffer != NULL) {
+    _buffer->unlock();
+  }
+}
+
+void AsyncLogWriter::flush_locked() {
+  if (_buffer != NULL) {
+    _buffer->write_out();
+  }
+}
+
+void asyncLogStream::write(const char* s, size_t len) {
+  if (!AsyncLogWriter::enqueue(_target, s, len)) {
+    // The writer may still be draining to the same target.
+    AsyncLogOutputLocker ol;
+    _target->write(s, len);
+  }
+  update_position(s, len);
+}
+
+void asyncLogStream::rotate_log(bool force, outputStream* out) {
+  // The writer thread does not stop for the safepoint rotation happens
+  // at, so keep it off the file while it is closed and reopened. Write
+  // out what belongs to the old file first.
+  AsyncLogOutputLocker ol;
+  AsyncLogWriter::flush_locked();
+  _target->rotate_log(force, out);
+}
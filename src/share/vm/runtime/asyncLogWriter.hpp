@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
+#define SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+
+// With -XX:+AsyncGCLogging, GC and safepoint log output is appended to a
+// bounded ring buffer and written to its stream by the AsyncLogWriter
+// thread, so a slow log device does not lengthen pauses. Producers never
+// block: a message that does not fit is dropped and counted, and the
+// writer reports the count before the next message it writes.
+
+// A multi-producer, single-consumer ring of 8-byte aligned records. A
+// producer claims space by advancing _head with a CAS, copies its message
+// and publishes the record by storing its size into the header. The
+// consumer writes out records from _tail up to the first unpublished one,
+// and zeroes each record before handing its space back to producers.
+class AsyncLogBuffer : public CHeapObj<mtInternal> {
+  struct Record {
+    volatile intptr_t _size;    // 0: not yet published, < 0: padding at the end
+    outputStream*     _target;
+    size_t            _length;
+  };
+
+  char*             _base;
+  size_t            _capacity;  // power of 2
+  volatile intptr_t _head;      // bytes claimed by producers
+  volatile intptr_t _tail;      // bytes released by the consumer
+  volatile jint     _draining;  // a consumer is active
+  volatile jint     _dropped;
+  jint              _reported;
+
+  Record* record_at(intptr_t pos) const {
+    return (Record*)(_base + (pos & (_capacity - 1)));
+  }
+
+ public:
+  AsyncLogBuffer(size_t capacity);
+
+  // Returns false, and counts the message as dropped, if it does not fit.
+  bool enqueue(outputStream* target, const char* s, size_t len);
+
+  bool is_empty() const { return _head == _tail; }
+  jint dropped() const  { return _dropped; }
+
+  // Writes out all published records. Only one thread drains at a time;
+  // if another one is, wait for it when 'wait' is set, or give up.
+  bool drain(bool wait);
+
+  // Claims the consumer side (as drain does) so that the caller can write
+  // to the target streams itself, or drain with write_out.
+  bool lock(bool wait);
+  void unlock();
+  void write_out();
+};
+
+class AsyncLogWriter : public NamedThread {
+  static AsyncLogWriter* _writer;
+  static AsyncLogBuffer* _buffer;
+  static outputStream*   _tty;
+  static volatile jint   _enabled;
+  static volatile bool   _should_terminate;
+
+  Semaphore     _wakeup;
+  volatile jint _waiting;       // set while the writer is about to sleep
+
+  AsyncLogWriter();
+
+ public:
+  virtual void run();
+
+  // Starts the writer and redirects gclog_or_tty through it.
+  static void initialize();
+  // Writes out pending output and stops the writer; later output is
+  // written synchronously again.
+  static void stop();
+
+  static bool is_enabled() { return _enabled != 0; }
+
+  // Queues a write to 'target'. Returns false if it has to be done by the
+  // caller, i.e. when the writer is not running or the caller is the writer.
+  static bool enqueue(outputStream* target, const char* s, size_t len);
+
+  // Writes out pending output on the calling thread.
+  static void flush(bool wait = true);
+
+  // Keep the writer off the log streams while the calling thread writes
+  // to them directly or rotates them. flush_locked() writes out pending
+  // output in between.
+  static void lock_output();
+  static void unlock_output();
+  static void flush_locked();
+
+  // Stream for log output that would otherwise go to tty during pauses.
+  static outputStream* tty_stream() { return is_enabled() ? _tty : tty; }
+
+  static jint dropped_messages() { return _buffer == NULL ? 0 : _buffer->dropped(); }
+};
+
+class AsyncLogOutputLocker : public StackObj {
+ public:
+  AsyncLogOutputLocker()  { AsyncLogWriter::lock_output(); }
+  ~AsyncLogOutputLocker() { AsyncLogWriter::unlock_output(); }
+};
+
+// Forwards writes to the AsyncLogWriter, falling back to writing directly
+// to the target stream when the writer is not running.
+class asyncLogStream : public outputStream {
+  outputStream* _target;
+ public:
+  asyncLogStream(outputStream* target) : outputStream(target->width()), _target(target) {
+    _stamp.update_to(target->time_stamp().ticks());
+  }
+  outputStream* target() const { return _target; }
+
+  virtual void write(const char* s, size_t len);
+  // The writer flushes the target after each batch.
+  virtual void flush() {}
+  virtual void rotate_log(bool force, outputStream* out = NULL);
+};
+
+#endif // SHARE_VM_RUNTIME_ASYNCLOGWRITER_HPP
@@ -27,6 +27,7 @@
 #include "oops/markOop.hpp"
 #include "runtime/basicLock.hpp"
 #include "runtime/biasedLocking.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/task.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
@@ -528,6 +529,79 @@ public:
 };
 
 
+// Revokes the bias of a single object held by another thread. Executed as a
+// thread-local handshake with the biased locker instead of a safepoint.
+class RevokeOneBias : public ThreadClosure {
+  Handle* _obj;
+  JavaThread* _requesting_thread;
+  JavaThread* _biased_locker;
+  BiasedLocking::Condition _status_code;
+  traceid _biased_locker_id;
+  bool _executed;
+
+public:
+  RevokeOneBias(Handle* obj, JavaThread* requesting_thread, JavaThread* biased_locker)
+    : _obj(obj)
+    , _requesting_thread(requesting_thread)
+    , _biased_locker(biased_locker)
+    , _status_code(BiasedLocking::NOT_BIASED)
+    , _biased_locker_id(0)
+    , _executed(false) {}
+
+  void do_thread(Thread* target) {
+    assert(target == _biased_locker, "wrong thread");
+    _executed = true;
+
+    oop o = (*_obj)();
+    markOop mark = o->mark();
+    if (!mark->has_bias_pattern()) {
+      return;
+    }
+
+    markOop prototype = o->klass()->prototype_header();
+    if (!prototype->has_bias_pattern()) {
+      // This object has a stale bias from before the handshake was
+      // requested. If we fail this race, the object's bias has been
+      // revoked by another thread so we simply return.
+      markOop unbiased_prototype = markOopDesc::prototype()->set_age(mark->age());
+      Atomic::cmpxchg_ptr(unbiased_prototype, o->mark_addr(), mark);
+      _status_code = BiasedLocking::BIAS_REVOKED;
+      return;
+    }
+
+    if (mark->biased_locker() == _biased_locker &&
+        prototype->bias_epoch() == mark->bias_epoch()) {
+      // Object is still biased towards the same thread and epoch, so
+      // revoke it while that thread is stopped.
+      ResourceMark rm;
+      if (TraceBiasedLocking) {
+        tty->print_cr("Revoking bias with thread-local handshake:");
+      }
+      _status_code = revoke_bias(o, false, false, _requesting_thread, NULL);
+      _biased_locker->set_cached_monitor_info(NULL);
+      assert(_status_code == BiasedLocking::BIAS_REVOKED, "why not?");
+#if INCLUDE_JFR
+      _biased_locker_id = JFR_THREAD_ID(_biased_locker);
+#endif // INCLUDE_JFR
+    } else {
+      // The bias changed hands while the handshake was pending; let the
+      // caller retry through the safepoint path.
+      _executed = false;
+    }
+  }
+
+  bool executed() const { return _executed; }
+
+  BiasedLocking::Condition status_code() const {
+    return _status_code;
+  }
+
+  traceid biased_locker() const {
+    return _biased_locker_id;
+  }
+};
+
+
 class VM_BulkRevokeBias : public VM_RevokeBias {
 private:
   bool _bulk_rebias;
@@ -643,7 +717,23 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
         event.commit();
       }
       return cond;
-    } else {
+    } else if (ThreadLocalHandshakes && mark->biased_locker() != NULL &&
+               prototype_header->bias_epoch() == mark->bias_epoch()) {
+      EventBiasedLockRevocation event;
+      JavaThread* biased_locker = mark->biased_locker();
+      RevokeOneBias revoke(&obj, (JavaThread*) THREAD, biased_locker);
+      if (Handshake::execute(&revoke, biased_locker) && revoke.executed()) {
+        if (event.should_commit() && (revoke.status_code() != NOT_BIASED)) {
+          event.set_lockClass(k);
+          event.set_previousOwner(revoke.biased_locker());
+          event.commit();
+        }
+        return revoke.status_code();
+      }
+      // The biased locker exited or the bias moved on; fall back to the
+      // safepoint based revocation which handles all of these cases.
+    }
+    {
       EventBiasedLockRevocation event;
       VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
       VMThread::execute(&revoke);
@@ -41,6 +41,7 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/fieldDescriptor.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -1661,8 +1662,9 @@ address Deoptimization::deoptimize_for_missing_exception_handler(nmethod* nm) {
 #endif
 
 void Deoptimization::deoptimize_frame_internal(JavaThread* thread, intptr_t* id, DeoptReason reason) {
-  assert(thread == Thread::current() || SafepointSynchronize::is_at_safepoint(),
-         "can only deoptimize other thread at a safepoint");
+  assert(thread == Thread::current() || SafepointSynchronize::is_at_safepoint() ||
+         thread->is_handshake_processing(),
+         "can only deoptimize other thread at a safepoint or handshake");
   // Compute frame and register map based on thread and sp.
   RegisterMap reg_map(thread, UseBiasedLocking);
   frame fr = thread->last_frame();
@@ -1673,9 +1675,25 @@ void Deoptimization::deoptimize_frame_internal(JavaThread* thread, intptr_t* id,
 }
 
 
+class DeoptimizeFrameClosure : public ThreadClosure {
+  intptr_t* _id;
+  Deoptimization::DeoptReason _reason;
+
+ public:
+  DeoptimizeFrameClosure(intptr_t* id, Deoptimization::DeoptReason reason) : _id(id), _reason(reason) {}
+
+  void do_thread(Thread* thread) {
+    Deoptimization::deoptimize_frame_internal((JavaThread*) thread, _id, _reason);
+  }
+};
+
 void Deoptimization::deoptimize_frame(JavaThread* thread, intptr_t* id, DeoptReason reason) {
   if (thread == Thread::current()) {
     Deoptimization::deoptimize_frame_internal(thread, id, reason);
+  } else if (ThreadLocalHandshakes && !SafepointSynchronize::is_at_safepoint()) {
+    // Only the target thread has to be stopped to patch its frame.
+    DeoptimizeFrameClosure cl(id, reason);
+    Handshake::execute(&cl, thread);
   } else {
     VM_DeoptimizeFrame deopt(thread, id, reason);
     VMThread::execute(&deopt);
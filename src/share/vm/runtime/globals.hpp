@@ -745,6 +745,12 @@ class CommandLineFlags {
   product(bool, UseAESIntrinsics, false,                                    \
           "Use intrinsics for AES versions of crypto")                      \
                                                                             \
+  product(bool, UseAESCTRIntrinsics, false,                                 \
+          "Use intrinsics for the AES version of counter mode encryption")  \
+                                                                            \
+  product(bool, UseFMA, false,                                              \
+          "Control whether FMA instructions can be used")                   \
+                                                                            \
   product(bool, UseSHA1Intrinsics, false,                                   \
           "Use intrinsics for SHA-1 crypto hash function")                  \
                                                                             \
@@ -757,6 +763,15 @@ class CommandLineFlags {
   product(bool, UseCRC32Intrinsics, false,                                  \
           "use intrinsics for java.util.zip.CRC32")                         \
                                                                             \
+  product(bool, UseCRC32CIntrinsics, false,                                 \
+          "use intrinsics for java.util.zip.CRC32C")                        \
+                                                                            \
+  product(bool, UseAdler32Intrinsics, false,                                \
+          "use intrinsics for java.util.zip.Adler32")                       \
+                                                                            \
+  product(bool, UseVectorizedMismatchIntrinsic, false,                      \
+          "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
+                                                                            \
   develop(bool, TraceCallFixup, false,                                      \
           "Trace all call fixups")                                          \
                                                                             \
@@ -960,6 +975,15 @@ class CommandLineFlags {
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  product(bool, HeapDumpParallel, false,                                    \
+          "Dump the objects of the heap on the parallel GC worker threads, "\
+          "each writing a part of the dump that is appended to the dump "   \
+          "file afterwards. Needs up to twice the disk space of the dump")  \
+                                                                            \
+  product(uintx, HeapDumpGzipLevel, 0,                                      \
+          "When non-zero, write heap dumps in gzip format using the given " \
+          "compression level (1-9)")                                        \
+                                                                            \
   develop(uintx, SegmentedHeapDumpThreshold, 2*G,                           \
           "Generate a segmented heap dump (JAVA PROFILE 1.0.2 format) "     \
           "when the heap usage is larger than this")                        \
@@ -1189,6 +1213,14 @@ class CommandLineFlags {
                                                                             \
   product(bool, MonitorInUseLists, false, "Track Monitors for Deflation")   \
                                                                             \
+  product(bool, AsyncDeflateIdleMonitors, false,                            \
+          "Deflate idle monitors on the service thread instead of at "      \
+          "safepoints")                                                     \
+                                                                            \
+  product(intx, AsyncDeflationInterval, 250,                                \
+          "Minimum time in milliseconds between async monitor deflation "   \
+          "passes")                                                         \
+                                                                            \
   product(intx, SyncFlags, 0, "(Unsafe, Unstable) Experimental Sync flags") \
                                                                             \
   product(intx, SyncVerbose, 0, "(Unstable)")                               \
@@ -1477,6 +1509,14 @@ class CommandLineFlags {
           "The standard deviation used by the parallel compact dead wood "  \
           "limiter (a number between 0-100)")                               \
                                                                             \
+  product(bool, ParallelOldIncrementalCompaction, false,                    \
+          "Let parallel compact full GCs that are not maximal compact only "\
+          "the sparse upper part of the old generation")                    \
+                                                                            \
+  product(uintx, ParallelOldIncrementalReclaimPercent, 50,                  \
+          "Percentage of the old generation's dead space an incremental "   \
+          "parallel compact full GC reclaims (a number between 1-100)")     \
+                                                                            \
   product(uintx, ParallelGCThreads, 0,                                      \
           "Number of parallel threads parallel gc will use")                \
                                                                             \
@@ -1830,6 +1870,10 @@ class CommandLineFlags {
   product(uintx, CMSRescanMultiple, 32,                                     \
           "Size (in cards) of CMS parallel rescan task")                    \
                                                                             \
+  product(bool, CMSStripedRescan, true,                                     \
+          "Give each CMS parallel remark worker a stripe of dirty card "    \
+          "rescan tasks and let idle workers steal from other stripes")     \
+                                                                            \
   product(uintx, CMSConcMarkMultiple, 32,                                   \
           "Size (in cards) of CMS concurrent MT marking task")              \
                                                                             \
@@ -1980,6 +2024,12 @@ class CommandLineFlags {
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(uintx, ReferencesPerThread, 1000,                                 \
+          "Ergonomically start one thread for this amount of "              \
+          "references for reference processing if "                         \
+          "ParallelRefProcEnabled is true. Specify 0 to disable and "       \
+          "use all threads")                                                \
+                                                                            \
   product(uintx, CMSTriggerRatio, 80,                                       \
           "Percentage of MinHeapFreeRatio in CMS generation that is "       \
           "allocated before a CMS collection cycle commences")              \
@@ -2375,6 +2425,10 @@ class CommandLineFlags {
   product(bool, UseGCTaskAffinity, false,                                   \
           "Use worker affinity when asking for GCTasks")                    \
                                                                             \
+  product(bool, UseGCTaskStealing, false,                                   \
+          "Hand out ParallelGC tasks from per-worker deques with work "     \
+          "stealing instead of from a single locked queue")                 \
+                                                                            \
   product(uintx, ProcessDistributionStride, 4,                              \
           "Stride through processors when distributing processes")          \
                                                                             \
@@ -2478,6 +2532,10 @@ class CommandLineFlags {
   manageable(bool, PrintClassHistogram, false,                              \
           "Print a histogram of class instances")                           \
                                                                             \
+  product(bool, ParallelHeapInspection, true,                               \
+          "Walk the heap on the parallel GC worker threads when building "  \
+          "class histograms outside of a collection")                       \
+                                                                            \
   develop(bool, TraceWorkGang, false,                                       \
           "Trace activities of work gangs")                                 \
                                                                             \
@@ -2540,6 +2598,14 @@ class CommandLineFlags {
           "GC log file size, requires UseGCLogFileRotation. "               \
           "Set to 0 to only trigger rotation via jcmd")                     \
                                                                             \
+  product(bool, AsyncGCLogging, false,                                      \
+          "Buffer GC and safepoint log output and write it from a "         \
+          "background thread instead of inside pauses")                     \
+                                                                            \
+  product(uintx, AsyncLogBufferSize, 2*M,                                   \
+          "Size in bytes of the AsyncGCLogging buffer, rounded down to a "  \
+          "power of 2. Messages that do not fit are dropped")               \
+                                                                            \
   /* JVMTI heap profiling */                                                \
                                                                             \
   diagnostic(bool, TraceJVMTIObjectTagging, false,                          \
@@ -2638,6 +2704,14 @@ class CommandLineFlags {
           "Print the break down of clean up tasks performed during "        \
           "safepoint")                                                      \
                                                                             \
+  product(bool, ParallelSafepointCleanup, true,                             \
+          "Run safepoint cleanup tasks on the parallel GC worker threads "  \
+          "when the heap has them")                                         \
+                                                                            \
+  product(bool, PrintSafepointCleanupShare, false,                          \
+          "Print the time spent in cleanup tasks as a share of the total "  \
+          "time of each safepoint")                                         \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -3050,6 +3124,14 @@ class CommandLineFlags {
   product(intx, SafepointTimeoutDelay, 10000,                               \
           "Delay in milliseconds for option SafepointTimeout")              \
                                                                             \
+  product(bool, ThreadLocalHandshakes, true,                                \
+          "Use thread-local handshakes instead of safepoints for "          \
+          "operations on a single thread")                                  \
+                                                                            \
+  diagnostic(uintx, HandshakeTimeout, 1,                                    \
+          "Milliseconds to wait for a thread to reach a handshake "         \
+          "before falling back to a safepoint")                             \
+                                                                            \
   product(intx, NmethodSweepFraction, 16,                                   \
           "Number of invocations of sweeper to cover all nmethods")         \
                                                                             \
@@ -3315,6 +3397,11 @@ class CommandLineFlags {
   product(uintx, MaxMetaspaceExpansion, ScaleForWordSize(4*M),              \
           "The maximum expansion of Metaspace without full GC (in bytes)")  \
                                                                             \
+  product(bool, MetaspaceReclaimFreeChunks, false,                          \
+          "Merge adjacent free Metaspace chunks, split larger free "        \
+          "chunks instead of committing new ones, and uncommit free "       \
+          "Metaspace memory after class unloading")                         \
+                                                                            \
   product(uintx, QueuedAllocationWarningCount, 0,                           \
           "Number of times an allocation that queues behind a GC "          \
           "will retry before printing a warning")                           \
@@ -3985,6 +4072,10 @@ class CommandLineFlags {
           "A string must reach this age (or be promoted to an old region) " \
           "to be considered for deduplication")                             \
                                                                             \
+  product(uintx, StringDeduplicationThreads, 1,                             \
+          "Number of threads to use for string deduplication, limited "     \
+          "by the number of parallel GC threads")                           \
+                                                                            \
   diagnostic(bool, StringDeduplicationResizeALot, false,                    \
           "Force table resize every time the table is scanned")             \
                                                                             \
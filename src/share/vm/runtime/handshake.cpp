@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/interfaceSupport.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/vmThread.hpp"
+#include "runtime/vm_operations.hpp"
+
+// Returns the live target of a handshake, or NULL if it has exited. A target
+// given as a java.lang.Thread is resolved here rather than by the requester,
+// while Threads_lock or a safepoint keeps it from being freed.
+static JavaThread* live_target(JavaThread* target, Handle thread_obj) {
+  assert_locked_or_safepoint(Threads_lock);
+  if (thread_obj.not_null()) {
+    target = java_lang_Thread::thread(thread_obj());
+  }
+  if (target == NULL || !Threads::includes(target) || target->is_terminated()) {
+    return NULL;
+  }
+  return target;
+}
+
+class HandshakeOperation : public StackObj {
+  ThreadClosure* _thread_cl;
+  volatile jint  _executed;
+
+ public:
+  HandshakeOperation(ThreadClosure* cl) : _thread_cl(cl), _executed(0) {}
+
+  void do_handshake(JavaThread* thread) {
+    _thread_cl->do_thread(thread);
+    OrderAccess::release_store(&_executed, 1);
+  }
+
+  bool executed() const { return OrderAccess::load_acquire((volatile jint*)&_executed) != 0; }
+};
+
+// Arms the handshake on the target thread and waits for it to be processed,
+// either by the target itself or by the VM thread on its behalf. Runs without
+// a safepoint; Threads_lock is held throughout so the target cannot leave
+// the Threads list while the operation is pending.
+class VM_HandshakeOneThread : public VM_Operation {
+  HandshakeOperation* _op;
+  JavaThread*         _target;
+  Handle              _thread_obj;
+  bool                _thread_alive;
+  bool                _timed_out;
+
+ public:
+  VM_HandshakeOneThread(HandshakeOperation* op, JavaThread* target, Handle thread_obj) :
+    _op(op), _target(target), _thread_obj(thread_obj), _thread_alive(false), _timed_out(false) {}
+
+  VMOp_Type type() const       { return VMOp_HandshakeOneThread; }
+  Mode evaluation_mode() const { return _no_safepoint; }
+
+  bool thread_alive() const    { return _thread_alive; }
+  bool timed_out() const       { return _timed_out; }
+
+  void doit() {
+    MutexLockerEx ml(Threads_lock, Mutex::_no_safepoint_check_flag);
+    _target = live_target(_target, _thread_obj);
+    if (_target == NULL) {
+      return;
+    }
+    _thread_alive = true;
+
+    _target->set_handshake_operation(_op);
+    jlong start = os::javaTimeNanos();
+    jlong timeout = (jlong)HandshakeTimeout * NANOSECS_PER_MILLISEC;
+    while (!_op->executed()) {
+      _target->handshake_process_by_vmthread();
+      if (_op->executed()) {
+        break;
+      }
+      if (os::javaTimeNanos() - start > timeout) {
+        // The target is most likely running compiled or interpreted code
+        // and will not pass a thread state transition any time soon.
+        if (_target->cancel_handshake()) {
+          _timed_out = true;
+          break;
+        }
+        // Lost the race against the target; it is running the operation.
+      }
+      os::naked_short_sleep(0);
+    }
+  }
+};
+
+// Executes the handshake closure at a safepoint when the target could not
+// be reached in time.
+class VM_HandshakeFallback : public VM_Operation {
+  ThreadClosure* _thread_cl;
+  JavaThread*    _target;
+  Handle         _thread_obj;
+  bool           _executed;
+
+ public:
+  VM_HandshakeFallback(ThreadClosure* cl, JavaThread* target, Handle thread_obj) :
+    _thread_cl(cl), _target(target), _thread_obj(thread_obj), _executed(false) {}
+
+  VMOp_Type type() const { return VMOp_HandshakeFallback; }
+  bool executed() const  { return _executed; }
+
+  void doit() {
+    JavaThread* target = live_target(_target, _thread_obj);
+    if (target != NULL) {
+      _thread_cl->do_thread(target);
+      _executed = true;
+    }
+  }
+};
+
+bool Handshake::execute(ThreadClosure* thread_cl, JavaThread* target, Handle thread_obj) {
+  assert(target == NULL || thread_obj.is_null(), "give either the thread or its java.lang.Thread");
+  Thread* current = Thread::current();
+  if (thread_obj.not_null() && java_lang_Thread::thread(thread_obj()) == current) {
+    // A thread cannot exit while it is running this code.
+    target = (JavaThread*) current;
+    thread_obj = Handle();
+  }
+  if (target == current) {
+    thread_cl->do_thread(target);
+    return true;
+  }
+  if (SafepointSynchronize::is_at_safepoint()) {
+    // Nested in a safepoint operation; every thread is already stopped.
+    assert(current->is_VM_thread(), "only the VM thread runs at a safepoint");
+    target = live_target(target, thread_obj);
+    if (target == NULL) {
+      return false;
+    }
+    thread_cl->do_thread(target);
+    return true;
+  }
+
+  if (ThreadLocalHandshakes) {
+    HandshakeOperation op(thread_cl);
+    VM_HandshakeOneThread handshake(&op, target, thread_obj);
+    VMThread::execute(&handshake);
+    if (op.executed()) {
+      return true;
+    }
+    if (!handshake.thread_alive()) {
+      return false;
+    }
+    assert(handshake.timed_out(), "handshake must have been withdrawn");
+  }
+
+  VM_HandshakeFallback fallback(thread_cl, target, thread_obj);
+  VMThread::execute(&fallback);
+  return fallback.executed();
+}
+
+HandshakeState::HandshakeState() :
+  _operation(NULL),
+  _semaphore(1),
+  _thread_in_process_handshake(false),
+  _processing(false) {
+}
+
+void HandshakeState::set_operation(JavaThread* target, HandshakeOperation* op) {
+  assert(Thread::current()->is_VM_thread(), "should be the VM thread");
+  assert(_operation == NULL, "only one handshake at a time");
+  _operation = op;
+  // Make the native wrappers and the native->VM transitions take their
+  // slow path so the target notices the operation.
+  target->set_handshake_pending();
+  if (SafepointSynchronize::uses_thread_local_poll()) {
+    // Trap the target at its next poll in compiled or interpreted code.
+    SafepointSynchronize::arm_local_poll(target);
+  }
+  OrderAccess::fence();
+}
+
+void HandshakeState::clear_handshake(JavaThread* target) {
+  _operation = NULL;
+  target->clear_handshake_pending();
+  if (SafepointSynchronize::uses_thread_local_poll()) {
+    // No safepoint can be in progress while the VM thread is busy with
+    // the handshake, so nobody else needs the poll armed.
+    SafepointSynchronize::disarm_local_poll(target);
+  }
+}
+
+void HandshakeState::do_operation(JavaThread* thread) {
+  HandshakeOperation* op = _operation;
+  _processing = true;
+  op->do_handshake(thread);
+  _processing = false;
+  clear_handshake(thread);
+}
+
+void HandshakeState::process_self_inner(JavaThread* thread) {
+  assert(Thread::current() == thread, "should call from thread");
+  // The VM thread may be running the operation on our behalf; wait for it
+  // to finish before we continue and change our stack.
+  _semaphore.wait();
+  if (has_operation()) {
+    do_operation(thread);
+  }
+  _semaphore.signal();
+}
+
+bool HandshakeState::vmthread_can_process_handshake(JavaThread* target) {
+  // The target state must be read after the operation was published, see
+  // the matching fence in the thread state transitions.
+  if (UseMembar) {
+    OrderAccess::fence();
+  } else {
+    os::serialize_thread_states();
+  }
+  JavaThreadState state = target->thread_state();
+  return state == _thread_blocked ||
+         (state == _thread_in_native && SafepointSynchronize::safepoint_safe(target, state));
+}
+
+void HandshakeState::process_by_vmthread(JavaThread* target) {
+  assert(Thread::current()->is_VM_thread(), "should call from vm thread");
+  if (!has_operation()) {
+    return;
+  }
+  // Claim the handshake; if the target holds the semaphore it is
+  // executing the operation itself.
+  if (!_semaphore.trywait()) {
+    return;
+  }
+  if (has_operation() && vmthread_can_process_handshake(target)) {
+    do_operation(target);
+  }
+  _semaphore.signal();
+}
+
+bool HandshakeState::cancel_operation(JavaThread* target) {
+  assert(Thread::current()->is_VM_thread(), "should call from vm thread");
+  if (!_semaphore.trywait()) {
+    return false;
+  }
+  bool cancelled = has_operation();
+  if (cancelled) {
+    clear_handshake(target);
+  }
+  _semaphore.signal();
+  return cancelled;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_HANDSHAKE_HPP
+#define SHARE_VM_RUNTIME_HANDSHAKE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.hpp"
+#include "runtime/semaphore.hpp"
+
+class HandshakeOperation;
+class JavaThread;
+class ThreadClosure;
+
+// A handshake is a ThreadClosure that is executed for one JavaThread while
+// that thread is stopped, without bringing all other threads to a safepoint.
+// The closure is run either by the target thread itself, the next time it
+// passes a thread state transition or traps on its thread-local safepoint
+// poll, or by the VM thread on its behalf if the target is blocked or in
+// native code with a walkable stack. If the target does not respond within
+// HandshakeTimeout milliseconds the operation is withdrawn and executed at
+// a regular safepoint instead.
+class Handshake : public AllStatic {
+  static bool execute(ThreadClosure* thread_cl, JavaThread* target, Handle thread_obj);
+
+ public:
+  // Execute the closure for the target thread. Returns false if the target
+  // thread was no longer alive and the closure was not run.
+  static bool execute(ThreadClosure* thread_cl, JavaThread* target) {
+    return execute(thread_cl, target, Handle());
+  }
+
+  // As above, for the JavaThread of a java.lang.Thread. The JavaThread is
+  // looked up by the VM operation itself, under Threads_lock, so it cannot
+  // exit and be freed between the lookup and the handshake.
+  static bool execute(ThreadClosure* thread_cl, Handle thread_obj) {
+    return execute(thread_cl, NULL, thread_obj);
+  }
+};
+
+// Per-thread handshake state, embedded in JavaThread. The semaphore ensures
+// that only one of the target thread and the VM thread runs the operation.
+class HandshakeState VALUE_OBJ_CLASS_SPEC {
+  HandshakeOperation* volatile _operation;
+
+  Semaphore _semaphore;
+  bool _thread_in_process_handshake;
+  volatile bool _processing;
+
+  void clear_handshake(JavaThread* thread);
+  void do_operation(JavaThread* thread);
+  void process_self_inner(JavaThread* thread);
+  bool vmthread_can_process_handshake(JavaThread* target);
+
+ public:
+  HandshakeState();
+
+  void set_operation(JavaThread* thread, HandshakeOperation* op);
+
+  bool has_operation() const { return _operation != NULL; }
+
+  // True while the operation is being executed, either by the owning thread
+  // or by the VM thread; used to relax at-safepoint assertions.
+  bool is_processing() const { return _processing; }
+
+  void process_by_self(JavaThread* thread) {
+    if (!_thread_in_process_handshake) {
+      FlagSetting fs(_thread_in_process_handshake, true);
+      process_self_inner(thread);
+    }
+  }
+
+  void process_by_vmthread(JavaThread* target);
+
+  // Withdraw a pending operation that has not started executing yet.
+  // Returns true if the operation was withdrawn.
+  bool cancel_operation(JavaThread* thread);
+};
+
+#endif // SHARE_VM_RUNTIME_HANDSHAKE_HPP
@@ -48,6 +48,7 @@
 #include "oops/symbol.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
@@ -570,6 +571,10 @@ void before_exit(JavaThread * thread) {
   // Note: we don't wait until it actually dies.
   os::terminate_signal_thread();
 
+  // Write out buffered GC and safepoint logging; from here on the
+  // remaining output is written synchronously and stays in order.
+  AsyncLogWriter::stop();
+
   print_statistics();
   Universe::heap()->print_tracing_info();
 
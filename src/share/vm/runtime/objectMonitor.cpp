@@ -318,7 +318,7 @@ bool ObjectMonitor::try_enter(Thread* THREAD) {
   }
 }
 
-void ATTR ObjectMonitor::enter(TRAPS) {
+bool ATTR ObjectMonitor::enter(TRAPS) {
   // The following code is ordered to check the most common cases first
   // and to reduce RTS->RTO cache line upgrades on SPARC and IA32 processors.
   Thread * const Self = THREAD ;
@@ -330,13 +330,13 @@ void ATTR ObjectMonitor::enter(TRAPS) {
      assert (_recursions == 0   , "invariant") ;
      assert (_owner      == Self, "invariant") ;
      // CONSIDER: set or assert OwnerIsThread == 1
-     return ;
+     return true ;
   }
 
   if (cur == Self) {
      // TODO-FIXME: check for integer overflow!  BUGID 6557169.
      _recursions ++ ;
-     return ;
+     return true ;
   }
 
   if (Self->is_lock_owned ((address)cur)) {
@@ -346,7 +346,7 @@ void ATTR ObjectMonitor::enter(TRAPS) {
     // a full-fledged "Thread *".
     _owner = Self ;
     OwnerIsThread = 1 ;
-    return ;
+    return true ;
   }
 
   // We've encountered genuine contention.
@@ -363,7 +363,7 @@ void ATTR ObjectMonitor::enter(TRAPS) {
      assert (_recursions == 0    , "invariant") ;
      assert (((oop)(object()))->mark() == markOopDesc::encode(this), "invariant") ;
      Self->_Stalled = 0 ;
-     return ;
+     return true ;
   }
 
   assert (_owner != Self          , "invariant") ;
@@ -372,13 +372,25 @@ void ATTR ObjectMonitor::enter(TRAPS) {
   JavaThread * jt = (JavaThread *) Self ;
   assert (!SafepointSynchronize::is_at_safepoint(), "invariant") ;
   assert (jt->thread_state() != _thread_blocked   , "invariant") ;
-  assert (this->object() != NULL  , "invariant") ;
-  assert (_count >= 0, "invariant") ;
+  assert (AsyncDeflateIdleMonitors || this->object() != NULL, "invariant") ;
+  assert (AsyncDeflateIdleMonitors || _count >= 0, "invariant") ;
 
   // Prevent deflation at STW-time.  See deflate_idle_monitors() and is_busy().
   // Ensure the object-monitor relationship remains stable while there's contention.
   Atomic::inc_ptr(&_count);
 
+  if (AsyncDeflateIdleMonitors && is_being_async_deflated()) {
+    // The async deflater won the race for this monitor.  Make sure the
+    // object's header has been restored and have the caller re-inflate.
+    oop obj = (oop) object();
+    if (obj != NULL) {
+      install_displaced_markword_in_object(obj);
+    }
+    Atomic::dec_ptr(&_count);
+    Self->_Stalled = 0 ;
+    return false ;
+  }
+
   JFR_ONLY(JfrConditionalFlushWithStacktrace<EventJavaMonitorEnter> flush(jt);)
   EventJavaMonitorEnter event;
   if (event.should_commit()) {
@@ -480,6 +492,19 @@ void ATTR ObjectMonitor::enter(TRAPS) {
   if (ObjectMonitor::_sync_ContendedLockAttempts != NULL) {
      ObjectMonitor::_sync_ContendedLockAttempts->inc() ;
   }
+  return true ;
+}
+
+// Restore the displaced header of an async deflated monitor into the
+// object.  Either the deflater or a racing thread that observed the
+// monitor being deflated does this; only the first CAS succeeds.
+void ObjectMonitor::install_displaced_markword_in_object(const oop obj) {
+  markOop dmw = header();
+  assert (dmw->is_neutral(), "invariant") ;
+  markOop inflated = markOopDesc::encode(this);
+  if (obj->mark() == inflated) {
+    obj->cas_set_mark(dmw, inflated);
+  }
 }
 
 
@@ -489,6 +514,16 @@ void ATTR ObjectMonitor::enter(TRAPS) {
 int ObjectMonitor::TryLock (Thread * Self) {
    for (;;) {
       void * own = _owner ;
+      if (own == DEFLATER_MARKER && (_count > 0 || _waiters > 0)) {
+         // The async deflater claimed the monitor but will give up on it
+         // because we are contending for it.  Take ownership directly so
+         // we cannot park on a monitor nobody is going to exit.
+         if (Atomic::cmpxchg_ptr (Self, &_owner, DEFLATER_MARKER) == DEFLATER_MARKER) {
+            assert (_recursions == 0, "invariant") ;
+            return 1 ;
+         }
+         continue ;
+      }
       if (own != NULL) return 0 ;
       if (Atomic::cmpxchg_ptr (Self, &_owner, NULL) == NULL) {
          // Either guarantee _recursions == 0 or set _recursions = 0.
@@ -1400,16 +1435,18 @@ intptr_t ObjectMonitor::complete_exit(TRAPS) {
 
 // reenter() enters a lock and sets recursion count
 // complete_exit/reenter operate as a wait without waiting
-void ObjectMonitor::reenter(intptr_t recursions, TRAPS) {
+bool ObjectMonitor::reenter(intptr_t recursions, TRAPS) {
    Thread * const Self = THREAD;
    assert(Self->is_Java_thread(), "Must be Java thread!");
    JavaThread *jt = (JavaThread *)THREAD;
 
    guarantee(_owner != Self, "reenter already owner");
-   enter (THREAD);       // enter the monitor
+   if (!enter (THREAD)) {  // enter the monitor
+     return false;         // monitor was async deflated, caller re-inflates
+   }
    guarantee (_recursions == 0, "reenter recursion");
    _recursions = recursions;
-   return;
+   return true;
 }
 
 
@@ -71,6 +71,10 @@ class ObjectWaiter : public StackObj {
 // It is also used as RawMonitor by the JVMTI
 
 
+// Owner value installed by the async monitor deflater while it tries
+// to take an idle monitor out of circulation. See deflate_monitor_async().
+#define DEFLATER_MARKER reinterpret_cast<void*>(-1)
+
 class ObjectMonitor {
  public:
   enum {
@@ -117,6 +121,11 @@ class ObjectMonitor {
 
   intptr_t  is_entered(Thread* current) const;
 
+  // A negative _count means the async deflater has claimed the monitor;
+  // entering threads must back off and re-inflate.
+  bool      is_being_async_deflated() const                            { return _count < 0; }
+  void      install_displaced_markword_in_object(const oop obj);
+
   void*     owner() const;
   void      set_owner(void* owner);
 
@@ -194,7 +203,7 @@ public:
 #endif
 
   bool      try_enter (TRAPS) ;
-  void      enter(TRAPS);
+  bool      enter(TRAPS);
   void      exit(bool not_suspended, TRAPS);
   void      wait(jlong millis, bool interruptable, TRAPS);
   void      notify(TRAPS);
@@ -202,7 +211,7 @@ public:
 
 // Use the following at your own risk
   intptr_t  complete_exit(TRAPS);
-  void      reenter(intptr_t recursions, TRAPS);
+  bool      reenter(intptr_t recursions, TRAPS);
 
  private:
   void      AddWaiter (ObjectWaiter * waiter) ;
@@ -267,6 +276,7 @@ public:
 
   volatile intptr_t  _count;        // reference count to prevent reclaimation/deflation
                                     // at stop-the-world time.  See deflate_idle_monitors().
+                                    // Negative while being deflated asynchronously.
                                     // _count is approximately |_WaitSet| + |_EntryList|
  protected:
   volatile intptr_t  _waiters;      // number of waiting threads
@@ -114,6 +114,7 @@ class os: AllStatic {
  private:
   static OSThread*          _starting_thread;
   static address            _polling_page;
+  static address            _local_polling_page;   // armed thread-local polls point here
   static volatile int32_t * _mem_serialize_page;
   static uintptr_t          _serialize_page_mask;
  public:
@@ -394,7 +395,12 @@ class os: AllStatic {
   // OS interface to polling page
   static address get_polling_page()             { return _polling_page; }
   static void    set_polling_page(address page) { _polling_page = page; }
-  static bool    is_poll_address(address addr)  { return addr >= _polling_page && addr < (_polling_page + os::vm_page_size()); }
+  static void    set_local_polling_page(address page) { _local_polling_page = page; }
+  static bool    is_poll_address(address addr)  {
+    return (addr >= _polling_page && addr < (_polling_page + os::vm_page_size())) ||
+           (_local_polling_page != NULL &&
+            addr >= _local_polling_page && addr < (_local_polling_page + os::vm_page_size()));
+  }
   static void    make_polling_page_unreadable();
   static void    make_polling_page_readable();
 
@@ -37,6 +37,7 @@
 #include "memory/universe.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/symbol.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
@@ -54,6 +55,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/workgroup.hpp"
 #ifdef TARGET_ARCH_x86
 # include "nativeInst_x86.hpp"
 # include "vmreg_x86.inline.hpp"
@@ -163,6 +165,8 @@ volatile int  SafepointSynchronize::_waiting_to_block = 0;
 volatile int SafepointSynchronize::_safepoint_counter = 0;
 int SafepointSynchronize::_current_jni_active_count = 0;
 long  SafepointSynchronize::_end_of_last_safepoint = 0;
+void* SafepointSynchronize::_poll_armed_value = NULL;
+void* SafepointSynchronize::_poll_disarmed_value = NULL;
 static volatile int PageArmed = 0 ;        // safepoint polling page is RO|RW vs PROT_NONE
 static volatile int TryingToBlock = 0 ;    // proximate value -- for advisory use only
 static bool timeout_error_printed = false;
@@ -173,7 +177,8 @@ void SafepointSynchronize::begin() {
   Thread* myThread = Thread::current();
   assert(myThread->is_VM_thread(), "Only VM thread may execute a safepoint");
 
-  if (PrintSafepointStatistics || PrintSafepointStatisticsTimeout > 0) {
+  if (PrintSafepointStatistics || PrintSafepointStatisticsTimeout > 0 ||
+      PrintSafepointCleanupShare) {
     _safepoint_begin_time = os::javaTimeNanos();
     _ts_of_current_safepoint = tty->time_stamp().seconds();
   }
@@ -275,6 +280,15 @@ void SafepointSynchronize::begin() {
   // Make interpreter safepoint aware
   Interpreter::notice_safepoints();
 
+  if (uses_thread_local_poll()) {
+    // Arm the polling word of every thread. Code which still polls the
+    // global page (near polls installed by JVMCI) is stopped below.
+    for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
+      arm_local_poll(cur);
+    }
+    OrderAccess::fence();
+  }
+
   if (UseCompilerSafepoints && DeferPollingPageLoopCount < 0) {
     // Make polling safepoint aware
     guarantee (PageArmed == 0, "invariant") ;
@@ -488,7 +502,11 @@ void SafepointSynchronize::begin() {
   // Call stuff that needs to be run when a safepoint is just about to be completed
   {
     EventSafepointCleanup cleanup_event;
+    jlong cleanup_start = PrintSafepointCleanupShare ? os::javaTimeNanos() : 0;
     do_cleanup_tasks();
+    if (PrintSafepointCleanupShare) {
+      _cleanup_time = os::javaTimeNanos() - cleanup_start;
+    }
     if (cleanup_event.should_commit()) {
       post_safepoint_cleanup_event(&cleanup_event);
     }
@@ -522,6 +540,10 @@ void SafepointSynchronize::end() {
     end_statistics(os::javaTimeNanos());
   }
 
+  if (PrintSafepointCleanupShare) {
+    print_cleanup_share(os::javaTimeNanos());
+  }
+
 #ifdef ASSERT
   // A pending_exception cannot be installed during a safepoint.  The threads
   // may install an async exception after they come back from a safepoint into
@@ -533,6 +555,12 @@ void SafepointSynchronize::end() {
   }
 #endif // ASSERT
 
+  if (uses_thread_local_poll()) {
+    for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
+      disarm_local_poll(cur);
+    }
+  }
+
   if (PageArmed) {
     // Make polling safepoint aware
     os::make_polling_page_readable();
@@ -604,69 +632,165 @@ void SafepointSynchronize::end() {
 bool SafepointSynchronize::is_cleanup_needed() {
   // Need a safepoint if some inline cache buffers is non-empty
   if (!InlineCacheBuffer::is_empty()) return true;
+  // Need a safepoint to grow the symbol or string table
+  if (SymbolTable::needs_resizing() || StringTable::needs_resizing()) return true;
+  // Need a safepoint to reclaim monitors deflated by the service thread
+  if (ObjectSynchronizer::is_cleanup_needed()) return true;
   return false;
 }
 
 
 
-// Various cleaning tasks that should be done periodically at safepoints
-void SafepointSynchronize::do_cleanup_tasks() {
-  {
-    const char* name = "deflating idle monitors";
-    EventSafepointCleanupTask event;
-    TraceTime t1(name, TraceSafepointCleanupTime);
-    ObjectSynchronizer::deflate_idle_monitors();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
-    }
+static const char* cleanup_task_name(uint task) {
+  switch (task) {
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_DEFLATE_MONITORS:     return "deflating idle monitors";
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES: return "updating inline caches";
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_COMPILATION_POLICY:   return "compilation policy safepoint handler";
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_MARK_NMETHODS:        return "mark nmethods";
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_SYMBOL_TABLE:         return "rehashing/resizing symbol table";
+    case SafepointSynchronize::SAFEPOINT_CLEANUP_STRING_TABLE:         return "rehashing/resizing string table";
+    default: ShouldNotReachHere(); return NULL;
   }
+}
 
-  {
-    const char* name = "updating inline caches";
-    EventSafepointCleanupTask event;
-    TraceTime t2(name, TraceSafepointCleanupTime);
-    InlineCacheBuffer::update_inline_caches();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+// Per-task elapsed time and worker of the current safepoint's cleanup,
+// reported with -XX:+TraceSafepointCleanupTime.
+static jlong cleanup_task_time[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS];
+static uint  cleanup_task_worker[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS];
+
+// Posts a JFR event for one step of a cleanup task.
+class SafepointCleanupStep : public StackObj {
+ private:
+  const char*               _name;
+  EventSafepointCleanupTask _event;
+ public:
+  SafepointCleanupStep(const char* name) : _name(name) { }
+  ~SafepointCleanupStep() {
+    if (_event.should_commit()) {
+      post_safepoint_cleanup_task_event(&_event, _name);
     }
   }
-  {
-    const char* name = "compilation policy safepoint handler";
-    EventSafepointCleanupTask event;
-    TraceTime t3(name, TraceSafepointCleanupTime);
-    CompilationPolicy::policy()->do_safepoint_work();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+};
+
+void SafepointSynchronize::do_cleanup_task(uint task, uint worker_id) {
+  jlong start = os::javaTimeNanos();
+  bool done = true;
+  switch (task) {
+    case SAFEPOINT_CLEANUP_DEFLATE_MONITORS: {
+      SafepointCleanupStep step("deflating idle monitors");
+      ObjectSynchronizer::deflate_idle_monitors();
+      break;
+    }
+    case SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES: {
+      SafepointCleanupStep step("updating inline caches");
+      InlineCacheBuffer::update_inline_caches();
+      break;
     }
+    case SAFEPOINT_CLEANUP_COMPILATION_POLICY: {
+      SafepointCleanupStep step("compilation policy safepoint handler");
+      CompilationPolicy::policy()->do_safepoint_work();
+      break;
+    }
+    case SAFEPOINT_CLEANUP_MARK_NMETHODS: {
+      SafepointCleanupStep step("mark nmethods");
+      NMethodSweeper::mark_active_nmethods();
+      break;
+    }
+    case SAFEPOINT_CLEANUP_SYMBOL_TABLE:
+      // Rehashing and resizing rebuild the same table, so they are one task.
+      done = false;
+      if (SymbolTable::needs_rehashing()) {
+        SafepointCleanupStep step("rehashing symbol table");
+        SymbolTable::rehash_table();
+        done = true;
+      }
+      if (SymbolTable::needs_resizing()) {
+        SafepointCleanupStep step("resizing symbol table");
+        SymbolTable::resize_table();
+        done = true;
+      }
+      break;
+    case SAFEPOINT_CLEANUP_STRING_TABLE:
+      done = false;
+      if (StringTable::needs_rehashing()) {
+        SafepointCleanupStep step("rehashing string table");
+        StringTable::rehash_table();
+        done = true;
+      }
+      if (StringTable::needs_resizing()) {
+        SafepointCleanupStep step("resizing string table");
+        StringTable::resize_table();
+        done = true;
+      }
+      break;
+    default:
+      ShouldNotReachHere();
   }
+  if (done) {
+    cleanup_task_time[task] = os::javaTimeNanos() - start;
+    cleanup_task_worker[task] = worker_id;
+  }
+}
 
-  {
-    const char* name = "mark nmethods";
-    EventSafepointCleanupTask event;
-    TraceTime t4(name, TraceSafepointCleanupTime);
-    NMethodSweeper::mark_active_nmethods();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+// Hands the cleanup tasks out to the heap's parallel GC workers, which are
+// idle at the start of a safepoint.  Each task is claimed by one worker.
+class ParallelSPCleanupTask : public AbstractGangTask {
+ private:
+  SubTasksDone _subtasks;
+
+ public:
+  ParallelSPCleanupTask(uint num_workers) :
+    AbstractGangTask("Parallel Safepoint Cleanup"),
+    _subtasks(SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS) {
+    _subtasks.set_n_threads(num_workers);
+  }
+
+  bool valid() { return _subtasks.valid(); }
+
+  void work(uint worker_id) {
+    for (uint t = 0; t < SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS; t++) {
+      if (!_subtasks.is_task_claimed(t)) {
+        SafepointSynchronize::do_cleanup_task(t, worker_id);
+      }
     }
+    _subtasks.all_tasks_completed();
   }
+};
 
-  if (SymbolTable::needs_rehashing()) {
-    const char* name = "rehashing symbol table";
-    EventSafepointCleanupTask event;
-    TraceTime t5(name, TraceSafepointCleanupTime);
-    SymbolTable::rehash_table();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+// Various cleaning tasks that should be done periodically at safepoints
+void SafepointSynchronize::do_cleanup_tasks() {
+  for (uint t = 0; t < SAFEPOINT_CLEANUP_NUM_TASKS; t++) {
+    cleanup_task_time[t] = -1;
+  }
+
+  WorkGang* workers = ParallelSafepointCleanup ?
+    Universe::heap()->get_safepoint_workers() : NULL;
+  bool parallel = false;
+  if (workers != NULL && workers->active_workers() > 1) {
+    ParallelSPCleanupTask cleanup(workers->active_workers());
+    if (cleanup.valid()) {
+      workers->run_task(&cleanup);
+      parallel = true;
+    }
+  }
+  if (!parallel) {
+    for (uint t = 0; t < SAFEPOINT_CLEANUP_NUM_TASKS; t++) {
+      do_cleanup_task(t, 0);
     }
   }
 
-  if (StringTable::needs_rehashing()) {
-    const char* name = "rehashing string table";
-    EventSafepointCleanupTask event;
-    TraceTime t6(name, TraceSafepointCleanupTime);
-    StringTable::rehash_table();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+  if (TraceSafepointCleanupTime) {
+    for (uint t = 0; t < SAFEPOINT_CLEANUP_NUM_TASKS; t++) {
+      if (cleanup_task_time[t] < 0) {
+        continue;
+      }
+      if (parallel) {
+        tty->print_cr("[%s, %3.7f secs, worker %u]", cleanup_task_name(t),
+                      (double)cleanup_task_time[t] / NANOSECS_PER_SEC, cleanup_task_worker[t]);
+      } else {
+        tty->print_cr("[%s, %3.7f secs]", cleanup_task_name(t),
+                      (double)cleanup_task_time[t] / NANOSECS_PER_SEC);
+      }
     }
   }
 
@@ -876,16 +1000,71 @@ void SafepointSynchronize::block(JavaThread *thread) {
 // Exception handlers
 
 
+void SafepointSynchronize::initialize_thread_local_polls() {
+  if (!uses_thread_local_poll()) {
+    return;
+  }
+  // Armed polling words point into a page that is never readable,
+  // disarmed ones into a page that always is. The global polling page is
+  // still armed and disarmed by safepoints for code that polls it.
+  size_t page_size = os::vm_page_size();
+  char* poll_pages = os::reserve_memory(2 * page_size, NULL, page_size);
+  if (poll_pages == NULL) {
+    vm_exit_out_of_memory(2 * page_size, OOM_MMAP_ERROR, "Unable to reserve safepoint polling pages");
+  }
+  os::commit_memory_or_exit(poll_pages, 2 * page_size, false, "Unable to commit safepoint polling pages");
+  char* bad_page  = poll_pages;
+  char* good_page = poll_pages + page_size;
+  os::protect_memory(bad_page, page_size, os::MEM_PROT_NONE);
+  os::protect_memory(good_page, page_size, os::MEM_PROT_READ);
+  os::set_local_polling_page((address)bad_page);
+
+  _poll_armed_value    = (void*)((intptr_t)bad_page | poll_bit());
+  _poll_disarmed_value = good_page;
+
+  if (Verbose && PrintMiscellaneous) {
+    tty->print_cr("[Thread-local safepoint polls: armed " INTPTR_FORMAT ", disarmed " INTPTR_FORMAT "]",
+                  p2i(_poll_armed_value), p2i(_poll_disarmed_value));
+  }
+}
+
+void SafepointSynchronize::arm_local_poll(JavaThread* thread) {
+  assert(uses_thread_local_poll(), "must use thread-local polls");
+  thread->set_polling_page(_poll_armed_value);
+}
+
+void SafepointSynchronize::disarm_local_poll(JavaThread* thread) {
+  assert(uses_thread_local_poll(), "must use thread-local polls");
+  thread->set_polling_page(_poll_disarmed_value);
+}
+
+// Called when a thread traps on a safepoint poll. With thread-local polls
+// the poll may also have been armed for a handshake outside of a safepoint.
+void SafepointSynchronize::block_at_poll(JavaThread* thread) {
+  if (!uses_thread_local_poll() || do_call_back()) {
+    block(thread);
+  }
+  if (uses_thread_local_poll() && thread->has_handshake()) {
+    // The stack is walkable from the safepoint stub; look like a thread in
+    // the VM while the operation runs so nobody else walks it concurrently.
+    JavaThreadState state = thread->thread_state();
+    thread->set_thread_state(_thread_in_vm);
+    thread->handshake_process_by_self();
+    thread->set_thread_state(state);
+  }
+}
+
 void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
   assert(thread->is_Java_thread(), "polling reference encountered by VM thread");
   assert(thread->thread_state() == _thread_in_Java, "should come from Java code");
-  assert(SafepointSynchronize::is_synchronizing(), "polling encountered outside safepoint synchronization");
+  assert(SafepointSynchronize::is_synchronizing() || uses_thread_local_poll(),
+         "polling encountered outside safepoint synchronization");
 
   if (ShowSafepointMsgs) {
     tty->print("handle_polling_page_exception: ");
   }
 
-  if (PrintSafepointStatistics) {
+  if (PrintSafepointStatistics && SafepointSynchronize::is_synchronizing()) {
     inc_page_trap_count();
   }
 
@@ -1130,7 +1309,7 @@ void ThreadSafepointState::handle_polling_page_exception() {
     }
 
     // Block the thread
-    SafepointSynchronize::block(thread());
+    SafepointSynchronize::block_at_poll(thread());
 
     // restore oop result, if any
     if (return_oop) {
@@ -1146,7 +1325,7 @@ void ThreadSafepointState::handle_polling_page_exception() {
     assert(real_return_addr == caller_fr.pc(), "must match");
 
     // Block the thread
-    SafepointSynchronize::block(thread());
+    SafepointSynchronize::block_at_poll(thread());
     set_at_poll_safepoint(false);
 
     // If we have a pending async exception deoptimize the frame
@@ -1173,6 +1352,19 @@ void ThreadSafepointState::handle_polling_page_exception() {
         fatal("Exception installed and deoptimization is pending");
       }
     }
+
+#ifdef THREAD_LOCAL_POLL
+    // With thread-local polls the register the poll reads through still
+    // holds the armed polling word, so resuming at the poll would trap
+    // again. Step over it unless the return address has been patched
+    // (e.g. for deoptimization) or an exception is being forwarded.
+    if (SafepointSynchronize::uses_thread_local_poll() && !thread()->has_pending_exception()) {
+      address* return_addr_slot = ((address*) caller_fr.sp()) - 1;
+      if (*return_addr_slot == real_return_addr) {
+        *return_addr_slot = real_return_addr + NativeTstRegMem::poll_instruction_size_at(real_return_addr);
+      }
+    }
+#endif
   }
 }
 
@@ -1188,23 +1380,24 @@ julong SafepointSynchronize::_coalesced_vmop_count = 0;
 jlong  SafepointSynchronize::_max_sync_time = 0;
 jlong  SafepointSynchronize::_max_vmop_time = 0;
 float  SafepointSynchronize::_ts_of_current_safepoint = 0.0f;
+jlong  SafepointSynchronize::_cleanup_time = 0;
 
 static jlong  cleanup_end_time = 0;
 static bool   need_to_track_page_armed_status = false;
 static bool   init_done = false;
 
 // Helper method to print the header.
-static void print_header() {
-  tty->print("         vmop                    "
-             "[threads: total initially_running wait_to_block]    ");
-  tty->print("[time: spin block sync cleanup vmop] ");
+static void print_header(outputStream* st) {
+  st->print("         vmop                    "
+            "[threads: total initially_running wait_to_block]    ");
+  st->print("[time: spin block sync cleanup vmop] ");
 
   // no page armed status printed out if it is always armed.
   if (need_to_track_page_armed_status) {
-    tty->print("page_armed ");
+    st->print("page_armed ");
   }
 
-  tty->print_cr("page_trap_count");
+  st->print_cr("page_trap_count");
 }
 
 void SafepointSynchronize::deferred_initialize_stat() {
@@ -1339,38 +1532,52 @@ void SafepointSynchronize::end_statistics(jlong vmop_end_time) {
   }
 }
 
+void SafepointSynchronize::print_cleanup_share(jlong end_time) {
+  outputStream* st = AsyncLogWriter::tty_stream();
+  jlong total = end_time - _safepoint_begin_time;
+  VM_Operation *op = VMThread::vm_operation();
+  st->print_cr("%.3f: [safepoint: %s, total %.3f ms, cleanup %.3f ms (%.1f%%)]",
+               _ts_of_current_safepoint,
+               (op != NULL) ? op->name() : "no vm operation",
+               (double)total / NANOSECS_PER_MILLISEC,
+               (double)_cleanup_time / NANOSECS_PER_MILLISEC,
+               total > 0 ? (double)_cleanup_time * 100.0 / total : 0.0);
+}
+
 void SafepointSynchronize::print_statistics() {
+  // Called inside the pause; keep the output off the VM thread if asked to.
+  outputStream* st = AsyncLogWriter::tty_stream();
   SafepointStats* sstats = _safepoint_stats;
 
   for (int index = 0; index <= _cur_stat_index; index++) {
     if (index % 30 == 0) {
-      print_header();
+      print_header(st);
     }
     sstats = &_safepoint_stats[index];
-    tty->print("%.3f: ", sstats->_time_stamp);
-    tty->print("%-26s       ["
-               INT32_FORMAT_W(8) INT32_FORMAT_W(11) INT32_FORMAT_W(15)
-               "    ]    ",
-               sstats->_vmop_type == -1 ? "no vm operation" :
-               VM_Operation::name(sstats->_vmop_type),
-               sstats->_nof_total_threads,
-               sstats->_nof_initial_running_threads,
-               sstats->_nof_threads_wait_to_block);
+    st->print("%.3f: ", sstats->_time_stamp);
+    st->print("%-26s       ["
+              INT32_FORMAT_W(8) INT32_FORMAT_W(11) INT32_FORMAT_W(15)
+              "    ]    ",
+              sstats->_vmop_type == -1 ? "no vm operation" :
+              VM_Operation::name(sstats->_vmop_type),
+              sstats->_nof_total_threads,
+              sstats->_nof_initial_running_threads,
+              sstats->_nof_threads_wait_to_block);
     // "/ MICROUNITS " is to convert the unit from nanos to millis.
-    tty->print("  ["
-               INT64_FORMAT_W(6) INT64_FORMAT_W(6)
-               INT64_FORMAT_W(6) INT64_FORMAT_W(6)
-               INT64_FORMAT_W(6) "    ]  ",
-               sstats->_time_to_spin / MICROUNITS,
-               sstats->_time_to_wait_to_block / MICROUNITS,
-               sstats->_time_to_sync / MICROUNITS,
-               sstats->_time_to_do_cleanups / MICROUNITS,
-               sstats->_time_to_exec_vmop / MICROUNITS);
+    st->print("  ["
+              INT64_FORMAT_W(6) INT64_FORMAT_W(6)
+              INT64_FORMAT_W(6) INT64_FORMAT_W(6)
+              INT64_FORMAT_W(6) "    ]  ",
+              sstats->_time_to_spin / MICROUNITS,
+              sstats->_time_to_wait_to_block / MICROUNITS,
+              sstats->_time_to_sync / MICROUNITS,
+              sstats->_time_to_do_cleanups / MICROUNITS,
+              sstats->_time_to_exec_vmop / MICROUNITS);
 
     if (need_to_track_page_armed_status) {
-      tty->print(INT32_FORMAT "         ", sstats->_page_armed);
+      st->print(INT32_FORMAT "         ", sstats->_page_armed);
     }
-    tty->print_cr(INT32_FORMAT "   ", sstats->_nof_threads_hit_page_trap);
+    st->print_cr(INT32_FORMAT "   ", sstats->_nof_threads_hit_page_trap);
   }
 }
 
@@ -75,6 +75,19 @@ class SafepointSynchronize : AllStatic {
     _blocking_timeout = 1
   };
 
+  // Independent cleanup tasks run at the start of every safepoint.
+  // They may be claimed by different workers and run in parallel.
+  enum SafepointCleanupTasks {
+    SAFEPOINT_CLEANUP_DEFLATE_MONITORS,
+    SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES,
+    SAFEPOINT_CLEANUP_COMPILATION_POLICY,
+    SAFEPOINT_CLEANUP_MARK_NMETHODS,
+    SAFEPOINT_CLEANUP_SYMBOL_TABLE,
+    SAFEPOINT_CLEANUP_STRING_TABLE,
+    // Leave this one last.
+    SAFEPOINT_CLEANUP_NUM_TASKS
+  };
+
   typedef struct {
     float  _time_stamp;                        // record when the current safepoint occurs in seconds
     int    _vmop_type;                         // type of VM operation triggers the safepoint
@@ -115,6 +128,11 @@ private:
   static jlong            _max_sync_time;            // maximum sync time in nanos
   static jlong            _max_vmop_time;            // maximum vm operation time in nanos
   static float            _ts_of_current_safepoint;  // time stamp of current safepoint in seconds
+  static jlong            _cleanup_time;             // time spent in cleanup tasks in nanos
+
+  // Values of JavaThread::_polling_page with thread-local polls
+  static void*            _poll_armed_value;         // address in a never readable page
+  static void*            _poll_disarmed_value;      // address of a readable page
 
   static void begin_statistics(int nof_threads, int nof_running);
   static void update_statistics_on_spin_end();
@@ -122,6 +140,7 @@ private:
   static void update_statistics_on_cleanup_end(jlong end_time);
   static void end_statistics(jlong end_time);
   static void print_statistics();
+  static void print_cleanup_share(jlong end_time);
   inline static void inc_page_trap_count() {
     Atomic::inc(&_safepoint_stats[_cur_stat_index]._nof_threads_hit_page_trap);
   }
@@ -160,8 +179,23 @@ public:
   static void   block(JavaThread *thread);
   static void   signal_thread_at_safepoint()              { _waiting_to_block--; }
 
+  // Thread-local polls. Each JavaThread has a polling word that compiled
+  // code dereferences and the interpreter tests at branches and returns.
+  // Arming one thread stops it without touching any page protection.
+#ifdef THREAD_LOCAL_POLL
+  static bool uses_thread_local_poll()                     { return ThreadLocalHandshakes; }
+#else
+  static bool uses_thread_local_poll()                     { return false; }
+#endif
+  static intptr_t poll_bit()                               { return 1; }
+  static void* poll_disarmed_value()                       { return _poll_disarmed_value; }
+  static void initialize_thread_local_polls();
+  static void arm_local_poll(JavaThread* thread);
+  static void disarm_local_poll(JavaThread* thread);
+
   // Exception handling for page polling
   static void handle_polling_page_exception(JavaThread *thread);
+  static void block_at_poll(JavaThread* thread);
 
   // VM Thread interface for determining safepoint rate
   static long last_non_safepoint_interval() {
@@ -172,6 +206,7 @@ public:
   }
   static bool is_cleanup_needed();
   static void do_cleanup_tasks();
+  static void do_cleanup_task(uint task, uint worker_id);
 
   // debugging
   static void print_state()                                PRODUCT_RETURN;
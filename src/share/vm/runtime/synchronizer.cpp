@@ -157,6 +157,17 @@ int ObjectSynchronizer::gOmInUseCount = 0;
 static volatile intptr_t ListLock = 0 ;      // protects global monitor free-list cache
 static volatile int MonitorFreeCount  = 0 ;      // # on gFreeList
 static volatile int MonitorPopulation = 0 ;      // # Extant -- in circulation
+
+// Async monitor deflation (-XX:+AsyncDeflateIdleMonitors).  Monitors
+// deflated by the service thread are parked on gWaitList until the next
+// safepoint, at which point no thread can still hold a stale reference
+// to them and they can be spliced onto gFreeList.
+static ObjectMonitor * volatile gWaitList = NULL ; // protected by ListLock
+static ObjectMonitor * gWaitTail = NULL ;          // protected by ListLock
+static int WaitListCount = 0 ;                      // # on gWaitList
+static volatile int AsyncDeflationRequested = 0 ;   // MonitorBound exceeded
+static volatile int InflatedSinceDeflation = 0 ;    // new monitors in circulation
+static jlong LastAsyncDeflation = 0 ;               // os::javaTimeMillis()
 #define CHAINMARKER (cast_to_oop<intptr_t>(-1))
 
 // -----------------------------------------------------------------------------
@@ -260,9 +271,12 @@ void ObjectSynchronizer::slow_enter(Handle obj, BasicLock* lock, TRAPS) {
   // must be non-zero to avoid looking like a re-entrant lock,
   // and must not look locked either.
   lock->set_displaced_header(markOopDesc::unused_mark());
-  ObjectSynchronizer::inflate(THREAD,
-                              obj(),
-                              inflate_cause_monitor_enter)->enter(THREAD);
+  // enter() fails only if the monitor was async deflated under us.
+  while (!ObjectSynchronizer::inflate(THREAD,
+                                     obj(),
+                                     inflate_cause_monitor_enter)->enter(THREAD)) {
+    TEVENT (slow_enter: retry after async deflation) ;
+  }
 }
 
 // This routine is used to handle interpreter/compiler slow case
@@ -307,11 +321,14 @@ void ObjectSynchronizer::reenter(Handle obj, intptr_t recursion, TRAPS) {
     assert(!obj->mark()->has_bias_pattern(), "biases should be revoked by now");
   }
 
-  ObjectMonitor* monitor = ObjectSynchronizer::inflate(THREAD,
-                                                       obj(),
-                                                       inflate_cause_vm_internal);
-
-  monitor->reenter(recursion, THREAD);
+  for (;;) {
+    ObjectMonitor* monitor = ObjectSynchronizer::inflate(THREAD,
+                                                         obj(),
+                                                         inflate_cause_vm_internal);
+    if (monitor->reenter(recursion, THREAD)) {
+      return;
+    }
+  }
 }
 // -----------------------------------------------------------------------------
 // JNI locks on java objects
@@ -324,7 +341,9 @@ void ObjectSynchronizer::jni_enter(Handle obj, TRAPS) { // possible entry from j
     assert(!obj->mark()->has_bias_pattern(), "biases should be revoked by now");
   }
   THREAD->set_current_pending_monitor_is_from_java(false);
-  ObjectSynchronizer::inflate(THREAD, obj(), inflate_cause_jni_enter)->enter(THREAD);
+  while (!ObjectSynchronizer::inflate(THREAD, obj(), inflate_cause_jni_enter)->enter(THREAD)) {
+    TEVENT (jni_enter: retry after async deflation) ;
+  }
   THREAD->set_current_pending_monitor_is_from_java(true);
 }
 
@@ -335,8 +354,18 @@ bool ObjectSynchronizer::jni_try_enter(Handle obj, Thread* THREAD) {
     assert(!obj->mark()->has_bias_pattern(), "biases should be revoked by now");
   }
 
-  ObjectMonitor* monitor = ObjectSynchronizer::inflate_helper(obj());
-  return monitor->try_enter(THREAD);
+  for (;;) {
+    ObjectMonitor* monitor = ObjectSynchronizer::inflate_helper(obj());
+    if (monitor->try_enter(THREAD)) {
+      return true;
+    }
+    // A monitor that is being async deflated looks owned; retry with the
+    // restored header instead of reporting contention.
+    if (!AsyncDeflateIdleMonitors || !monitor->is_being_async_deflated()) {
+      return false;
+    }
+    monitor->install_displaced_markword_in_object(obj());
+  }
 }
 
 
@@ -657,75 +686,91 @@ intptr_t ObjectSynchronizer::FastHashCode (Thread * Self, oop obj) {
   ObjectMonitor* monitor = NULL;
   markOop temp, test;
   intptr_t hash;
-  markOop mark = ReadStableMark (obj);
+  for (;;) {
+    markOop mark = ReadStableMark (obj);
 
-  // object should remain ineligible for biased locking
-  assert (!mark->has_bias_pattern(), "invariant") ;
+    // object should remain ineligible for biased locking
+    assert (!mark->has_bias_pattern(), "invariant") ;
 
-  if (mark->is_neutral()) {
-    hash = mark->hash();              // this is a normal header
-    if (hash) {                       // if it has hash, just return it
-      return hash;
-    }
-    hash = get_next_hash(Self, obj);  // allocate a new hash code
-    temp = mark->copy_set_hash(hash); // merge the hash code into header
-    // use (machine word version) atomic operation to install the hash
-    test = (markOop) Atomic::cmpxchg_ptr(temp, obj->mark_addr(), mark);
-    if (test == mark) {
-      return hash;
-    }
-    // If atomic operation failed, we must inflate the header
-    // into heavy weight monitor. We could add more code here
-    // for fast path, but it does not worth the complexity.
-  } else if (mark->has_monitor()) {
-    monitor = mark->monitor();
-    temp = monitor->header();
-    assert (temp->is_neutral(), "invariant") ;
-    hash = temp->hash();
-    if (hash) {
-      return hash;
+    if (mark->is_neutral()) {
+      hash = mark->hash();              // this is a normal header
+      if (hash) {                       // if it has hash, just return it
+        return hash;
+      }
+      hash = get_next_hash(Self, obj);  // allocate a new hash code
+      temp = mark->copy_set_hash(hash); // merge the hash code into header
+      // use (machine word version) atomic operation to install the hash
+      test = (markOop) Atomic::cmpxchg_ptr(temp, obj->mark_addr(), mark);
+      if (test == mark) {
+        return hash;
+      }
+      // If atomic operation failed, we must inflate the header
+      // into heavy weight monitor. We could add more code here
+      // for fast path, but it does not worth the complexity.
+    } else if (mark->has_monitor()) {
+      monitor = mark->monitor();
+      temp = monitor->header();
+      assert (temp->is_neutral(), "invariant") ;
+      hash = temp->hash();
+      if (hash) {
+        // The monitor may be async deflated with a header that predates
+        // the hash; only trust the hash if the monitor is still live.
+        OrderAccess::loadload();
+        if (AsyncDeflateIdleMonitors && monitor->is_being_async_deflated()) {
+          monitor->install_displaced_markword_in_object(obj);
+          continue;
+        }
+        return hash;
+      }
+      // Skip to the following code to reduce code size
+    } else if (Self->is_lock_owned((address)mark->locker())) {
+      temp = mark->displaced_mark_helper(); // this is a lightweight monitor owned
+      assert (temp->is_neutral(), "invariant") ;
+      hash = temp->hash();              // by current thread, check if the displaced
+      if (hash) {                       // header contains hash code
+        return hash;
+      }
+      // WARNING:
+      //   The displaced header is strictly immutable.
+      // It can NOT be changed in ANY cases. So we have
+      // to inflate the header into heavyweight monitor
+      // even the current thread owns the lock. The reason
+      // is the BasicLock (stack slot) will be asynchronously
+      // read by other threads during the inflate() function.
+      // Any change to stack may not propagate to other threads
+      // correctly.
     }
-    // Skip to the following code to reduce code size
-  } else if (Self->is_lock_owned((address)mark->locker())) {
-    temp = mark->displaced_mark_helper(); // this is a lightweight monitor owned
-    assert (temp->is_neutral(), "invariant") ;
-    hash = temp->hash();              // by current thread, check if the displaced
-    if (hash) {                       // header contains hash code
-      return hash;
+
+    // Inflate the monitor to set hash code
+    monitor = ObjectSynchronizer::inflate(Self, obj, inflate_cause_hash_code);
+    // Load displaced header and check it has hash code
+    mark = monitor->header();
+    assert (mark->is_neutral(), "invariant") ;
+    hash = mark->hash();
+    if (hash == 0) {
+      hash = get_next_hash(Self, obj);
+      temp = mark->copy_set_hash(hash); // merge hash code into header
+      assert (temp->is_neutral(), "invariant") ;
+      test = (markOop) Atomic::cmpxchg_ptr(temp, monitor, mark);
+      if (test != mark) {
+        // The only update to the header in the monitor (outside GC)
+        // is install the hash code. If someone add new usage of
+        // displaced header, please update this code
+        hash = test->hash();
+        assert (test->is_neutral(), "invariant") ;
+        assert (hash != 0, "Trivial unexpected object/monitor header usage.");
+      }
     }
-    // WARNING:
-    //   The displaced header is strictly immutable.
-    // It can NOT be changed in ANY cases. So we have
-    // to inflate the header into heavyweight monitor
-    // even the current thread owns the lock. The reason
-    // is the BasicLock (stack slot) will be asynchronously
-    // read by other threads during the inflate() function.
-    // Any change to stack may not propagate to other threads
-    // correctly.
-  }
-
-  // Inflate the monitor to set hash code
-  monitor = ObjectSynchronizer::inflate(Self, obj, inflate_cause_hash_code);
-  // Load displaced header and check it has hash code
-  mark = monitor->header();
-  assert (mark->is_neutral(), "invariant") ;
-  hash = mark->hash();
-  if (hash == 0) {
-    hash = get_next_hash(Self, obj);
-    temp = mark->copy_set_hash(hash); // merge hash code into header
-    assert (temp->is_neutral(), "invariant") ;
-    test = (markOop) Atomic::cmpxchg_ptr(temp, monitor, mark);
-    if (test != mark) {
-      // The only update to the header in the monitor (outside GC)
-      // is install the hash code. If someone add new usage of
-      // displaced header, please update this code
-      hash = test->hash();
-      assert (test->is_neutral(), "invariant") ;
-      assert (hash != 0, "Trivial unexpected object/monitor header usage.");
+    OrderAccess::loadload();
+    if (AsyncDeflateIdleMonitors && monitor->is_being_async_deflated()) {
+      // The deflater may have restored a header without our hash into
+      // the object; start over with the object's header.
+      monitor->install_displaced_markword_in_object(obj);
+      continue;
     }
+    // We finally get the hash
+    return hash;
   }
-  // We finally get the hash
-  return hash;
 }
 
 // Deprecated -- use FastHashCode() instead.
@@ -797,7 +842,7 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
   // not at a safepoint.
   if (mark->has_monitor()) {
     void * owner = mark->monitor()->_owner ;
-    if (owner == NULL) return owner_none ;
+    if (owner == NULL || owner == DEFLATER_MARKER) return owner_none ;
     return (owner == self ||
             self->is_lock_owned((address)owner)) ? owner_self : owner_other;
   }
@@ -833,6 +878,9 @@ JavaThread* ObjectSynchronizer::get_lock_owner(Handle h_obj, bool doLock) {
     ObjectMonitor* monitor = mark->monitor();
     assert(monitor != NULL, "monitor should be non-null");
     owner = (address) monitor->owner();
+    if (owner == (address) DEFLATER_MARKER) {
+      owner = NULL;
+    }
   }
 
   if (owner != NULL) {
@@ -940,11 +988,17 @@ static void InduceScavenge (Thread * Self, const char * Whence) {
       ::printf ("Monitor scavenge - Induced STW @%s (%d)\n", Whence, ForceMonitorScavenge) ;
       ::fflush(stdout) ;
     }
-    // Induce a 'null' safepoint to scavenge monitors
-    // Must VM_Operation instance be heap allocated as the op will be enqueue and posted
-    // to the VMthread and have a lifespan longer than that of this activation record.
-    // The VMThread will delete the op when completed.
-    VMThread::execute (new VM_ForceAsyncSafepoint()) ;
+    if (AsyncDeflateIdleMonitors) {
+      // Let the service thread deflate first; it posts the safepoint
+      // that reclaims the deflated monitors.
+      ObjectSynchronizer::request_async_deflation() ;
+    } else {
+      // Induce a 'null' safepoint to scavenge monitors
+      // Must VM_Operation instance be heap allocated as the op will be enqueue and posted
+      // to the VMthread and have a lifespan longer than that of this activation record.
+      // The VMThread will delete the op when completed.
+      VMThread::execute (new VM_ForceAsyncSafepoint()) ;
+    }
 
     if (ObjectMonitor::Knob_Verbose) {
       ::printf ("Monitor scavenge - STW posted @%s (%d)\n", Whence, ForceMonitorScavenge) ;
@@ -1016,6 +1070,12 @@ ObjectMonitor * ATTR ObjectSynchronizer::omAlloc (Thread * Self) {
                 ObjectMonitor * take = gFreeList ;
                 gFreeList = take->FreeNext ;
                 guarantee (take->object() == NULL, "invariant") ;
+                if (take->_owner == DEFLATER_MARKER) {
+                  // Async deflated; nobody can reference it any more.
+                  guarantee (take->is_being_async_deflated(), "invariant") ;
+                  take->_count = 0 ;
+                  take->_owner = NULL ;
+                }
                 guarantee (!take->is_busy(), "invariant") ;
                 take->Recycle() ;
                 omRelease (Self, take, false) ;
@@ -1271,7 +1331,9 @@ ObjectMonitor * ATTR ObjectSynchronizer::inflate (Thread * Self,
       if (mark->has_monitor()) {
           ObjectMonitor * inf = mark->monitor() ;
           assert (inf->header()->is_neutral(), "invariant");
-          assert (inf->object() == object, "invariant") ;
+          // An async deflater may be clearing the monitor concurrently;
+          // callers detect that when they try to use it.
+          assert (AsyncDeflateIdleMonitors || inf->object() == object, "invariant") ;
           assert (ObjectSynchronizer::verify_objmon_isinpool(inf), "monitor is invalid");
           return inf ;
       }
@@ -1377,6 +1439,7 @@ ObjectMonitor * ATTR ObjectSynchronizer::inflate (Thread * Self,
           // Hopefully the performance counters are allocated on distinct cache lines
           // to avoid false sharing on MP systems ...
           if (ObjectMonitor::_sync_Inflations != NULL) ObjectMonitor::_sync_Inflations->inc() ;
+          if (AsyncDeflateIdleMonitors && InflatedSinceDeflation == 0) InflatedSinceDeflation = 1 ;
           TEVENT(Inflate: overwrite stacklock) ;
           if (TraceMonitorInflation) {
             if (object->is_instance()) {
@@ -1430,6 +1493,7 @@ ObjectMonitor * ATTR ObjectSynchronizer::inflate (Thread * Self,
       // Hopefully the performance counters are allocated on distinct
       // cache lines to avoid false sharing on MP systems ...
       if (ObjectMonitor::_sync_Inflations != NULL) ObjectMonitor::_sync_Inflations->inc() ;
+      if (AsyncDeflateIdleMonitors && InflatedSinceDeflation == 0) InflatedSinceDeflation = 1 ;
       TEVENT(Inflate: overwrite neutral) ;
       if (TraceMonitorInflation) {
         if (object->is_instance()) {
@@ -1564,6 +1628,10 @@ int ObjectSynchronizer::walk_monitor_list(ObjectMonitor** listheadp,
 
 void ObjectSynchronizer::deflate_idle_monitors() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (AsyncDeflateIdleMonitors) {
+    reclaim_async_deflated_monitors();
+    return;
+  }
   int nInuse = 0 ;              // currently associated with objects
   int nInCirculation = 0 ;      // extant
   int nScavenged = 0 ;          // reclaimed
@@ -1661,6 +1729,193 @@ void ObjectSynchronizer::deflate_idle_monitors() {
   GVars.stwCycle ++ ;
 }
 
+// Async deflation of idle monitors
+// --------------------------------
+// With -XX:+AsyncDeflateIdleMonitors the service thread deflates idle
+// monitors while mutators run, so the cost of a safepoint no longer
+// grows with the monitor population.  The deflater claims a monitor in
+// two steps:
+//
+//  1. CAS _owner from NULL to DEFLATER_MARKER.  This fails if the
+//     monitor is owned, and makes the fast-path CAS in enter() fail.
+//  2. CAS _count from 0 to -max_jint.  A thread that bumped _count in
+//     enter() before this makes the CAS fail; the deflater then backs
+//     out, or the contending thread steals DEFLATER_MARKER in TryLock().
+//     A thread that bumps _count afterwards sees a negative value,
+//     restores the object header and retries with a fresh monitor.
+//
+// Once both steps succeed the displaced header goes back into the object
+// and the monitor is parked on gWaitList.  Threads that read the old
+// mark just before deflation cannot cross a safepoint while they still
+// use the monitor, so the next safepoint splices gWaitList onto
+// gFreeList in constant time.
+
+bool ObjectSynchronizer::deflate_monitor_async(ObjectMonitor* mid, oop obj,
+                                               ObjectMonitor** FreeHeadp,
+                                               ObjectMonitor** FreeTailp) {
+  // The object:monitor association is only trustworthy once inflate()
+  // has published the monitor in the object's header.
+  if (obj->mark() != markOopDesc::encode(mid) || mid->is_busy()) {
+    return false;
+  }
+  if (Atomic::cmpxchg_ptr(DEFLATER_MARKER, &mid->_owner, NULL) != NULL) {
+    return false;
+  }
+  if (mid->_waiters != 0 ||
+      Atomic::cmpxchg_ptr(-max_jint, &mid->_count, (intptr_t)0) != 0) {
+    // A thread is waiting on or contending for the monitor; give it back.
+    // If a contending thread already took ownership from us this fails.
+    Atomic::cmpxchg_ptr(NULL, &mid->_owner, DEFLATER_MARKER);
+    return false;
+  }
+
+  TEVENT (deflate_idle_monitors_async - scavenge1) ;
+  if (TraceMonitorInflation) {
+    if (obj->is_instance()) {
+      ResourceMark rm;
+      tty->print_cr("Async deflating object " INTPTR_FORMAT " , mark " INTPTR_FORMAT " , type %s",
+                    (void *) obj, (intptr_t) obj->mark(), obj->klass()->external_name());
+    }
+  }
+
+  // Restore the header back to obj.  Racing threads that saw the monitor
+  // being deflated may have done this already.  _owner and _count stay
+  // marked until the monitor is handed out again by omAlloc().
+  mid->install_displaced_markword_in_object(obj);
+  mid->set_object(NULL);
+
+  mid->FreeNext = NULL;
+  if (*FreeHeadp == NULL) *FreeHeadp = mid;
+  if (*FreeTailp != NULL) {
+    (*FreeTailp)->FreeNext = mid;
+  }
+  *FreeTailp = mid;
+  return true;
+}
+
+// Hand a batch of async deflated monitors over to the next safepoint.
+static void publish_deflated_monitors(ObjectMonitor* head, ObjectMonitor* tail, int count) {
+  if (head == NULL) {
+    return;
+  }
+  Thread::muxAcquire (&ListLock, "deflate_idle_monitors_async") ;
+  if (gWaitList == NULL) {
+    gWaitTail = tail ;
+  }
+  tail->FreeNext = gWaitList ;
+  gWaitList = head ;
+  WaitListCount += count ;
+  Thread::muxRelease (&ListLock) ;
+}
+
+void ObjectSynchronizer::deflate_idle_monitors_async(JavaThread* self) {
+  assert(AsyncDeflateIdleMonitors, "only used with AsyncDeflateIdleMonitors");
+  assert(self == Thread::current() && self->thread_state() == _thread_in_vm, "invariant");
+  int nInuse = 0 ;              // currently associated with objects
+  int nInCirculation = 0 ;      // extant
+  int nScavenged = 0 ;          // reclaimed
+
+  AsyncDeflationRequested = 0 ;
+  InflatedSinceDeflation = 0 ;
+  OrderAccess::fence() ;
+
+  ObjectMonitor * FreeHead = NULL ;  // Local SLL of deflated monitors
+  ObjectMonitor * FreeTail = NULL ;
+  int nBatch = 0 ;
+
+  TEVENT (deflate_idle_monitors_async) ;
+  // gBlockList is grow-only and blocks are never freed, so it can be
+  // walked without ListLock.
+  ObjectMonitor* block =
+    (ObjectMonitor*)OrderAccess::load_ptr_acquire(&gBlockList);
+  for (; block != NULL; block = (ObjectMonitor*)next(block)) {
+    nInCirculation += _BLOCKSIZE;
+    for (int i = 1; i < _BLOCKSIZE; i++) {
+      ObjectMonitor* mid = (ObjectMonitor*)&block[i];
+      oop obj = (oop)mid->object();
+      if (obj == NULL) {
+        // Free, or already deflated and waiting for a safepoint.
+        continue;
+      }
+      if (deflate_monitor_async(mid, obj, &FreeHead, &FreeTail)) {
+        nScavenged++;
+        nBatch++;
+      } else {
+        nInuse++;
+      }
+    }
+
+    // Don't hold up a pending safepoint.  No monitor is half deflated
+    // here and we hold no oops, so it is safe to block.
+    if (SafepointSynchronize::is_synchronizing()) {
+      publish_deflated_monitors(FreeHead, FreeTail, nBatch);
+      FreeHead = FreeTail = NULL;
+      nBatch = 0;
+      ThreadBlockInVM tbivm(self);
+    }
+  }
+  publish_deflated_monitors(FreeHead, FreeTail, nBatch);
+  LastAsyncDeflation = os::javaTimeMillis();
+
+  if (ObjectMonitor::Knob_Verbose) {
+    ::printf ("Async deflate: InCirc=%d InUse=%d Scavenged=%d ForceMonitorScavenge=%d : pop=%d free=%d\n",
+        nInCirculation, nInuse, nScavenged, ForceMonitorScavenge,
+        MonitorPopulation, MonitorFreeCount) ;
+    ::fflush(stdout) ;
+  }
+  if (ObjectMonitor::_sync_Deflations != NULL) ObjectMonitor::_sync_Deflations->inc(nScavenged) ;
+  if (ObjectMonitor::_sync_MonExtant  != NULL) ObjectMonitor::_sync_MonExtant ->set_value(nInCirculation);
+
+  if (ForceMonitorScavenge != 0 && nScavenged > 0) {
+    // MonitorBound was exceeded; reclaim the deflated monitors right away.
+    VMThread::execute (new VM_ForceAsyncSafepoint()) ;
+  }
+}
+
+// Called at a safepoint: no thread can still reference a monitor on
+// gWaitList, so move them all to gFreeList.
+void ObjectSynchronizer::reclaim_async_deflated_monitors() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  TEVENT (reclaim_async_deflated_monitors) ;
+  Thread::muxAcquire (&ListLock, "scavenge - return") ;
+  if (gWaitList != NULL) {
+    guarantee (gWaitTail != NULL && WaitListCount > 0, "invariant") ;
+    // constant-time list splice - prepend deflated segment to gFreeList
+    gWaitTail->FreeNext = gFreeList ;
+    gFreeList = gWaitList ;
+    MonitorFreeCount += WaitListCount ;
+    gWaitList = NULL ;
+    gWaitTail = NULL ;
+    WaitListCount = 0 ;
+  }
+  ForceMonitorScavenge = 0;    // Reset
+  Thread::muxRelease (&ListLock) ;
+
+  GVars.stwRandom = os::random() ;
+  GVars.stwCycle ++ ;
+}
+
+bool ObjectSynchronizer::is_async_deflation_needed() {
+  if (!AsyncDeflateIdleMonitors) {
+    return false;
+  }
+  if (AsyncDeflationRequested != 0) {
+    return true;
+  }
+  return InflatedSinceDeflation != 0 &&
+         os::javaTimeMillis() - LastAsyncDeflation >= (jlong)AsyncDeflationInterval;
+}
+
+bool ObjectSynchronizer::is_cleanup_needed() {
+  return gWaitList != NULL;
+}
+
+void ObjectSynchronizer::request_async_deflation() {
+  AsyncDeflationRequested = 1 ;
+  MutexLockerEx ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  Service_lock->notify_all();
+}
+
 // Monitor cleanup on JavaThread::exit
 
 // Iterate through monitor cache and attempt to release thread's monitors
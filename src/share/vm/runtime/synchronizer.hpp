@@ -131,6 +131,15 @@ class ObjectSynchronizer : AllStatic {
                                ObjectMonitor** FreeTailp);
   static bool deflate_monitor(ObjectMonitor* mid, oop obj, ObjectMonitor** FreeHeadp,
                               ObjectMonitor** FreeTailp);
+
+  // Concurrent deflation on the service thread (AsyncDeflateIdleMonitors)
+  static void deflate_idle_monitors_async(JavaThread* self);
+  static bool deflate_monitor_async(ObjectMonitor* mid, oop obj, ObjectMonitor** FreeHeadp,
+                                    ObjectMonitor** FreeTailp);
+  static void reclaim_async_deflated_monitors();
+  static bool is_async_deflation_needed();
+  static bool is_cleanup_needed();
+  static void request_async_deflation();
   static void oops_do(OopClosure* f);
 
   // debugging
@@ -51,6 +51,7 @@
 #include "prims/jvmtiThreadState.hpp"
 #include "prims/privilegedStack.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/fprofiler.hpp"
@@ -1612,6 +1613,7 @@ void JavaThread::initialize() {
 
   // Setup safepoint state info for this thread
   ThreadSafepointState::create(this);
+  _polling_page = SafepointSynchronize::poll_disarmed_value();
 
   debug_only(_java_call_counter = 0);
 
@@ -2532,6 +2534,10 @@ void JavaThread::check_safepoint_and_suspend_for_native_trans(JavaThread *thread
     SafepointSynchronize::block(curJT);
   }
 
+  if (curJT == thread && thread->has_handshake()) {
+    thread->handshake_process_by_self();
+  }
+
   if (thread->is_deopt_suspend()) {
     thread->clear_deopt_suspend();
     RegisterMap map(thread, false);
@@ -3516,6 +3522,8 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   jint os_init_2_result = os::init_2();
   if (os_init_2_result != JNI_OK) return os_init_2_result;
 
+  SafepointSynchronize::initialize_thread_local_polls();
+
   jint adjust_after_os_result = Arguments::adjust_after_os();
   if (adjust_after_os_result != JNI_OK) return adjust_after_os_result;
 
@@ -3623,6 +3631,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     }
   }
 
+  // Route pause-time GC and safepoint logging through the async writer
+  AsyncLogWriter::initialize();
+
   assert (Universe::is_fully_initialized(), "not initialized");
   if (VerifyDuringStartup) {
     // Make sure we're starting with a clean slate.
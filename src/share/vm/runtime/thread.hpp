@@ -31,6 +31,7 @@
 #include "prims/jni.h"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/frame.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -200,6 +201,7 @@ class Thread: public ThreadShadow {
 
     _has_async_exception    = 0x00000001U, // there is a pending async exception
     _critical_native_unlock = 0x00000002U, // Must call back to unlock JNI critical lock
+    _handshake_pending      = 0x00000008U, // a thread-local handshake is armed
 
     JFR_ONLY(_trace_flag    = 0x00000004U)  // call jfr tracing
   };
@@ -868,6 +870,8 @@ class JavaThread: public Thread {
   volatile JavaThreadState _thread_state;
  private:
   ThreadSafepointState *_safepoint_state;        // Holds information about a thread during a safepoint
+  HandshakeState _handshake;                     // Pending thread-local handshake, if any
+  volatile void* _polling_page;                  // Thread-local polling word, see SafepointSynchronize
   address               _saved_exception_pc;     // Saved pc of instruction where last implicit exception happened
 
   // JavaThread termination support
@@ -1155,6 +1159,20 @@ class JavaThread: public Thread {
   void set_safepoint_state(ThreadSafepointState *state) { _safepoint_state = state; }
   bool is_at_poll_safepoint()                    { return _safepoint_state->is_at_poll_safepoint(); }
 
+  // Thread-local poll support
+  void* polling_page() const                     { return (void*) _polling_page; }
+  void set_polling_page(void* poll_value)        { _polling_page = poll_value; }
+
+  // Thread-local handshake support
+  void set_handshake_operation(HandshakeOperation* op) {
+    _handshake.set_operation(this, op);
+  }
+  bool has_handshake() const                     { return _handshake.has_operation(); }
+  bool is_handshake_processing() const           { return _handshake.is_processing(); }
+  void handshake_process_by_self()               { _handshake.process_by_self(this); }
+  void handshake_process_by_vmthread()           { _handshake.process_by_vmthread(this); }
+  bool cancel_handshake()                        { return _handshake.cancel_operation(this); }
+
   // thread has called JavaThread::exit() or is terminated
   bool is_exiting()                              { return _terminated == _thread_exiting || is_terminated(); }
   // thread is terminated (no longer on the threads list); we compare
@@ -1223,6 +1241,9 @@ class JavaThread: public Thread {
   // via the appropriate -XX options.
   bool wait_for_ext_suspend_completion(int count, int delay, uint32_t *bits);
 
+  void set_handshake_pending()    { set_suspend_flag  (_handshake_pending); }
+  void clear_handshake_pending()  { clear_suspend_flag(_handshake_pending); }
+
   void set_external_suspend()     { set_suspend_flag  (_external_suspend); }
   void clear_external_suspend()   { clear_suspend_flag(_external_suspend); }
 
@@ -1471,6 +1492,7 @@ class JavaThread: public Thread {
   static ByteSize vm_result_2_offset()           { return byte_offset_of(JavaThread, _vm_result_2         ); }
   static ByteSize thread_state_offset()          { return byte_offset_of(JavaThread, _thread_state        ); }
   static ByteSize saved_exception_pc_offset()    { return byte_offset_of(JavaThread, _saved_exception_pc  ); }
+  static ByteSize polling_page_offset()          { return byte_offset_of(JavaThread, _polling_page        ); }
   static ByteSize osthread_offset()              { return byte_offset_of(JavaThread, _osthread            ); }
 #if INCLUDE_JVMCI
   static ByteSize pending_deoptimization_offset() { return byte_offset_of(JavaThread, _pending_deoptimization); }
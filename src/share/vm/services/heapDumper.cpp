@@ -38,9 +38,11 @@
 #include "runtime/vmThread.hpp"
 #include "runtime/vm_operations.hpp"
 #include "services/heapDumper.hpp"
+#include "services/heapDumperCompression.hpp"
 #include "services/threadService.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/workgroup.hpp"
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/parallelScavenge/parallelScavengeHeap.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -402,7 +404,7 @@ class DumpWriter : public StackObj {
   void write_internal(void* s, size_t len);
 
  public:
-  DumpWriter(const char* path);
+  DumpWriter(const char* path, bool overwrite = false);
   ~DumpWriter();
 
   void close();
@@ -440,22 +442,28 @@ class DumpWriter : public StackObj {
   void write_id(u4 x);
 };
 
-DumpWriter::DumpWriter(const char* path) {
+DumpWriter::DumpWriter(const char* path, bool overwrite) {
   // try to allocate an I/O buffer of io_buffer_size. If there isn't
   // sufficient memory then reduce size until we can allocate something.
-  _size = io_buffer_size;
-  do {
+  _size = (path == NULL) ? 0 : io_buffer_size;
+  _buffer = NULL;
+  while (_buffer == NULL && _size > 0) {
     _buffer = (char*)os::malloc(_size, mtInternal);
     if (_buffer == NULL) {
       _size = _size >> 1;
     }
-  } while (_buffer == NULL && _size > 0);
+  }
   assert((_size > 0 && _buffer != NULL) || (_size == 0 && _buffer == NULL), "sanity check");
   _pos = 0;
   _error = NULL;
   _bytes_written = 0L;
   _dump_start = (jlong)-1;
-  _fd = os::create_binary_file(path, false);    // don't replace existing file
+  if (path == NULL) {
+    // writer without a file
+    _fd = -1;
+    return;
+  }
+  _fd = os::create_binary_file(path, overwrite);
 
   // if the open failed we record the error
   if (_fd < 0) {
@@ -676,8 +684,20 @@ class DumperSupport : AllStatic {
   // fixes up the length of the current dump record
   static void write_current_dump_record_length(DumpWriter* writer);
 
+  // used on a sub-record boundary to check if we need to start a
+  // new segment
+  static void check_segment_length(DumpWriter* writer);
+
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
   static void end_of_dump(DumpWriter* writer);
+
+  // appends a part file of a segmented dump, as a gzip member if
+  // "compressor" is not NULL, and removes the file
+  static const char* append_dump_part(DumpWriter* writer, const char* part_path,
+                                      GzipCompressor* compressor);
+
+  // writes the HPROF_HEAP_DUMP_END record of a segmented dump
+  static void end_of_segmented_dump(DumpWriter* writer, GzipCompressor* compressor);
 };
 
 // write a header of the given type
@@ -1392,24 +1412,19 @@ class StickyClassDumper : public KlassClosure {
 };
 
 
-class VM_HeapDumper;
-
 // Support class using when iterating over the heap.
 
 class HeapObjectDumper : public ObjectClosure {
  private:
-  VM_HeapDumper* _dumper;
   DumpWriter* _writer;
 
-  VM_HeapDumper* dumper()               { return _dumper; }
   DumpWriter* writer()                  { return _writer; }
 
   // used to indicate that a record has been writen
   void mark_end_of_record();
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
-    _dumper = dumper;
+  HeapObjectDumper(DumpWriter* writer) {
     _writer = writer;
   }
 
@@ -1449,6 +1464,9 @@ class VM_HeapDumper : public VM_GC_Operation {
   static VM_HeapDumper* _global_dumper;
   static DumpWriter*    _global_writer;
   DumpWriter*           _local_writer;
+  const char*           _part_path;
+  uint                  _num_parts;
+  char*                 _part_error;
   JavaThread*           _oome_thread;
   Method*               _oome_constructor;
   bool _gc_before_heap_dump;
@@ -1494,13 +1512,24 @@ class VM_HeapDumper : public VM_GC_Operation {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // HPROF_GC_INSTANCE_DUMP, HPROF_GC_OBJ_ARRAY_DUMP and
+  // HPROF_GC_PRIM_ARRAY_DUMP records
+  void dump_objects();
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  // If "part_path" is not NULL the dump is segmented: the objects may be
+  // written to part files by the GC worker threads, and the caller appends
+  // the parts and the HPROF_HEAP_DUMP_END record to the dump.
+  VM_HeapDumper(DumpWriter* writer, const char* part_path,
+                bool gc_before_heap_dump, bool oome) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
                     gc_before_heap_dump) {
     _local_writer = writer;
+    _part_path = part_path;
+    _num_parts = 0;
+    _part_error = NULL;
     _gc_before_heap_dump = gc_before_heap_dump;
     _klass_map = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, true);
     _stack_traces = NULL;
@@ -1526,8 +1555,16 @@ class VM_HeapDumper : public VM_GC_Operation {
       FREE_C_HEAP_ARRAY(ThreadStackTrace*, _stack_traces, mtInternal);
     }
     delete _klass_map;
+    if (_part_error != NULL) {
+      os::free(_part_error);
+    }
   }
 
+  // number of part files written by the GC worker threads
+  uint num_parts() const         { return _num_parts; }
+  // error message if writing one of the part files failed
+  const char* part_error() const { return _part_error; }
+
   VMOp_Type type() const { return VMOp_HeapDumper; }
   // used to mark sub-record boundary
   void check_segment_length();
@@ -1582,17 +1619,21 @@ void DumperSupport::write_current_dump_record_length(DumpWriter* writer) {
 
 // used on a sub-record boundary to check if we need to start a
 // new segment.
-void VM_HeapDumper::check_segment_length() {
-  if (writer()->is_open()) {
-    julong dump_len = writer()->current_record_length();
+void DumperSupport::check_segment_length(DumpWriter* writer) {
+  if (writer->is_open()) {
+    julong dump_len = writer->current_record_length();
 
     if (dump_len > 2UL*G) {
-      DumperSupport::write_current_dump_record_length(writer());
-      DumperSupport::write_dump_header(writer());
+      write_current_dump_record_length(writer);
+      write_dump_header(writer);
     }
   }
 }
 
+void VM_HeapDumper::check_segment_length() {
+  DumperSupport::check_segment_length(writer());
+}
+
 // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
 void DumperSupport::end_of_dump(DumpWriter* writer) {
   if (writer->is_open()) {
@@ -1604,11 +1645,120 @@ void DumperSupport::end_of_dump(DumpWriter* writer) {
   }
 }
 
+// Returns an error message if the part could not be read, NULL otherwise.
+const char* DumperSupport::append_dump_part(DumpWriter* writer, const char* part_path,
+                                            GzipCompressor* compressor) {
+  int fd = os::open(part_path, O_RDONLY, 0);
+  if (fd < 0) {
+    return strerror(errno);
+  }
+
+  const char* error = NULL;
+  const size_t buffer_size = 1*M;
+  u1* buffer = NEW_C_HEAP_ARRAY(u1, buffer_size, mtInternal);
+  if (compressor != NULL) {
+    compressor->begin_member();
+  }
+  while (true) {
+    ssize_t n = (ssize_t)os::restartable_read(fd, buffer, (unsigned int)buffer_size);
+    if (n < 0) {
+      error = strerror(errno);
+      break;
+    }
+    if (compressor == NULL) {
+      writer->write_raw(buffer, (size_t)n);
+    } else {
+      // the member ends with an empty final block once the part is read
+      compressor->compress(buffer, (size_t)n, n == 0);
+      writer->write_raw((void*)compressor->output(), compressor->output_length());
+      compressor->reset_output();
+    }
+    if (n == 0) {
+      break;
+    }
+  }
+  FREE_C_HEAP_ARRAY(u1, buffer, mtInternal);
+  ::close(fd);
+  remove(part_path);
+  return error;
+}
+
+void DumperSupport::end_of_segmented_dump(DumpWriter* writer, GzipCompressor* compressor) {
+  u1 record[] = { HPROF_HEAP_DUMP_END, 0, 0, 0, 0, 0, 0, 0, 0 };
+  if (compressor == NULL) {
+    writer->write_raw(record, sizeof(record));
+  } else {
+    compressor->begin_member();
+    compressor->compress(record, sizeof(record), true);
+    writer->write_raw((void*)compressor->output(), compressor->output_length());
+    compressor->reset_output();
+  }
+}
+
 // marks sub-record boundary
 void HeapObjectDumper::mark_end_of_record() {
-  dumper()->check_segment_length();
+  DumperSupport::check_segment_length(writer());
+}
+
+// Returns the path of the file holding part "part" of a segmented heap
+// dump, or the uncompressed main part of the dump if "part" is -1.
+static void dump_part_path(char* buf, size_t buflen, const char* path, int part) {
+  if (part < 0) {
+    jio_snprintf(buf, buflen, "%s.part", path);
+  } else {
+    jio_snprintf(buf, buflen, "%s.part%d", path, part);
+  }
 }
 
+// Dumps the objects of the heap on the parallel GC worker threads. Each
+// worker writes its HPROF_HEAP_DUMP_SEGMENT records to a part file of its
+// own; the part files are appended to the dump file once the VM operation
+// is done.
+class ParHeapObjectDumpTask : public AbstractGangTask {
+ private:
+  const char*    _path;
+  char* volatile _error;
+
+  void set_error(const char* error) {
+    char* copy = os::strdup(error);
+    if (Atomic::cmpxchg_ptr(copy, &_error, NULL) != NULL) {
+      os::free(copy);
+    }
+  }
+
+ public:
+  ParHeapObjectDumpTask(const char* path) :
+    AbstractGangTask("Parallel Heap Dump"), _path(path), _error(NULL) { }
+
+  ~ParHeapObjectDumpTask() {
+    if (_error != NULL) {
+      os::free(_error);
+    }
+  }
+
+  // error message of the first worker that failed to write its part
+  const char* error() const { return _error; }
+
+  void work(uint worker_id) {
+    HandleMark hm;
+    ResourceMark rm;
+    char part_path[JVM_MAXPATHLEN];
+    dump_part_path(part_path, sizeof(part_path), _path, (int)worker_id);
+
+    DumpWriter writer(part_path, true /* overwrite */);
+    if (writer.is_open()) {
+      DumperSupport::write_dump_header(&writer);
+      HeapObjectDumper obj_dumper(&writer);
+      Universe::heap()->par_object_iterate(&obj_dumper, worker_id);
+      DumperSupport::write_current_dump_record_length(&writer);
+      writer.close();
+    }
+    if (writer.error() != NULL) {
+      set_error(writer.error());
+    }
+  }
+};
+
 // writes a HPROF_LOAD_CLASS record for the class (and each of its
 // array classes)
 void VM_HeapDumper::do_load_class(Klass* k) {
@@ -1781,6 +1931,12 @@ void VM_HeapDumper::do_threads() {
 // HPROF_GC_INSTANCE_DUMP, HPROF_GC_OBJ_ARRAY_DUMP, and HPROF_GC_PRIM_ARRAY_DUMP
 // records as we go. Once that is done we write records for some of the GC
 // roots.
+//
+// If the dump is segmented (HeapDumpParallel or HeapDumpGzipLevel), the
+// objects may be dumped by the parallel GC worker threads, each one into a
+// part file with HPROF_HEAP_DUMP_SEGMENT records of its own. The parts and
+// the HPROF_HEAP_DUMP_END record are appended by HeapDumper::dump once the
+// VM operation is done, compressing each part if HeapDumpGzipLevel is set.
 
 void VM_HeapDumper::doit() {
 
@@ -1839,8 +1995,7 @@ void VM_HeapDumper::doit() {
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->safe_object_iterate(&obj_dumper);
+  dump_objects();
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
@@ -1870,13 +2025,33 @@ void VM_HeapDumper::doit() {
   SystemDictionary::always_strong_classes_do(&class_dumper);
 
   // fixes up the length of the dump record and writes the HPROF_HEAP_DUMP_END record.
-  DumperSupport::end_of_dump(writer());
+  // A segmented dump is ended once its parts have been appended.
+  if (_part_path == NULL) {
+    DumperSupport::end_of_dump(writer());
+  } else {
+    DumperSupport::write_current_dump_record_length(writer());
+  }
 
   // Now we clear the global variables, so that a future dumper might run.
   clear_global_dumper();
   clear_global_writer();
 }
 
+void VM_HeapDumper::dump_objects() {
+  CollectedHeap* ch = Universe::heap();
+  if (_part_path != NULL && HeapDumpParallel && !ch->is_gc_active()) {
+    ParHeapObjectDumpTask task(_part_path);
+    _num_parts = ch->run_par_object_iterate_task(&task);
+    if (task.error() != NULL) {
+      _part_error = os::strdup(task.error());
+    }
+  }
+  if (_num_parts == 0) {
+    HeapObjectDumper obj_dumper(writer());
+    ch->safe_object_iterate(&obj_dumper);
+  }
+}
+
 void VM_HeapDumper::dump_stack_traces() {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer(), HPROF_TRACE, 3*sizeof(u4));
@@ -1953,8 +2128,28 @@ int HeapDumper::dump(const char* path) {
     return -1;
   }
 
+  // A parallel or compressed dump is segmented: the VM operation leaves
+  // parts of the dump in files next to the dump file, which are appended
+  // to it once the safepoint is over. With compression the VM operation
+  // writes to an uncompressed part too, and every part is compressed into
+  // a gzip member of its own as it is appended.
+  bool compress = HeapDumpGzipLevel > 0;
+  bool segmented = HeapDumpParallel || compress;
+  char part_path[JVM_MAXPATHLEN];
+  dump_part_path(part_path, sizeof(part_path), path, -1);
+  DumpWriter main_part(compress ? part_path : NULL, true /* overwrite */);
+  if (compress && !main_part.is_open()) {
+    set_error(main_part.error());
+    if (print_to_tty()) {
+      tty->print_cr("Unable to create %s: %s", part_path,
+        (error() != NULL) ? error() : "reason unknown");
+    }
+    return -1;
+  }
+
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  VM_HeapDumper dumper(compress ? &main_part : &writer,
+                       segmented ? path : NULL, _gc_before_heap_dump, _oome);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -1962,9 +2157,39 @@ int HeapDumper::dump(const char* path) {
     VMThread::execute(&dumper);
   }
 
+  if (segmented) {
+    const char* part_error = dumper.part_error();
+    GzipCompressor* compressor = NULL;
+    if (compress) {
+      main_part.close();
+      if (main_part.error() != NULL) {
+        part_error = main_part.error();
+      }
+      compressor = new GzipCompressor((uint)HeapDumpGzipLevel);
+      const char* e = DumperSupport::append_dump_part(&writer, part_path, compressor);
+      if (part_error == NULL) {
+        part_error = e;
+      }
+    }
+    for (uint i = 0; i < dumper.num_parts(); i++) {
+      dump_part_path(part_path, sizeof(part_path), path, (int)i);
+      const char* e = DumperSupport::append_dump_part(&writer, part_path, compressor);
+      if (part_error == NULL) {
+        part_error = e;
+      }
+    }
+    DumperSupport::end_of_segmented_dump(&writer, compressor);
+    delete compressor;
+    if (part_error != NULL) {
+      set_error((char*)part_error);
+    }
+  }
+
   // close dump file and record any error that the writer may have encountered
   writer.close();
-  set_error(writer.error());
+  if (error() == NULL) {
+    set_error(writer.error());
+  }
 
   // print message in interactive case
   if (print_to_tty()) {
@@ -1973,11 +2198,11 @@ int HeapDumper::dump(const char* path) {
       tty->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
                     writer.bytes_written(), timer()->seconds());
     } else {
-      tty->print_cr("Dump file is incomplete: %s", writer.error());
+      tty->print_cr("Dump file is incomplete: %s", error());
     }
   }
 
-  return (writer.error() == NULL) ? 0 : -1;
+  return (error() == NULL) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoader.hpp"
+#include "services/heapDumperCompression.hpp"
+
+// Base values and extra bits of the deflate length codes 257..285
+static const int length_base[] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const int length_extra[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+// Base values and extra bits of the deflate distance codes 0..29
+static const int distance_base[] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+  8193, 12289, 16385, 24577
+};
+static const int distance_extra[] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+GzipCompressor::GzipCompressor(uint level) :
+  _out(NULL), _out_capacity(0), _out_length(0),
+  _bit_buffer(0), _bit_count(0), _crc(0), _input_size(0) {
+  assert(level >= 1 && level <= 9, "invalid compression level");
+  _max_chain = 1 << (level - 1);
+  _head = NEW_C_HEAP_ARRAY(int, hash_size, mtInternal);
+  _prev = NEW_C_HEAP_ARRAY(int, window_size, mtInternal);
+}
+
+GzipCompressor::~GzipCompressor() {
+  FREE_C_HEAP_ARRAY(int, _head, mtInternal);
+  FREE_C_HEAP_ARRAY(int, _prev, mtInternal);
+  if (_out != NULL) {
+    FREE_C_HEAP_ARRAY(u1, _out, mtInternal);
+  }
+}
+
+void GzipCompressor::ensure_output(size_t len) {
+  if (_out_length + len > _out_capacity) {
+    size_t capacity = MAX2(_out_length + len, 2 * _out_capacity);
+    _out = REALLOC_C_HEAP_ARRAY(u1, _out, capacity, mtInternal);
+    _out_capacity = capacity;
+  }
+}
+
+void GzipCompressor::put_bits(juint value, int count) {
+  _bit_buffer |= value << _bit_count;
+  _bit_count += count;
+  while (_bit_count >= 8) {
+    put_byte((u1)_bit_buffer);
+    _bit_buffer >>= 8;
+    _bit_count -= 8;
+  }
+}
+
+// Huffman codes are packed starting with their most significant bit.
+void GzipCompressor::put_code(juint code, int length) {
+  juint reversed = 0;
+  for (int i = 0; i < length; i++) {
+    reversed = (reversed << 1) | (code & 1);
+    code >>= 1;
+  }
+  put_bits(reversed, length);
+}
+
+void GzipCompressor::flush_bits() {
+  if (_bit_count > 0) {
+    put_byte((u1)_bit_buffer);
+  }
+  _bit_buffer = 0;
+  _bit_count = 0;
+}
+
+void GzipCompressor::put_literal(int literal) {
+  if (literal < 144) {
+    put_code(0x30 + literal, 8);
+  } else {
+    put_code(0x190 + literal - 144, 9);
+  }
+}
+
+void GzipCompressor::put_match(int length, int distance) {
+  int i = (int)(sizeof(length_base) / sizeof(length_base[0])) - 1;
+  while (length_base[i] > length) {
+    i--;
+  }
+  int symbol = 257 + i;
+  if (symbol < 280) {
+    put_code(symbol - 256, 7);
+  } else {
+    put_code(0xc0 + symbol - 280, 8);
+  }
+  put_bits(length - length_base[i], length_extra[i]);
+
+  int j = (int)(sizeof(distance_base) / sizeof(distance_base[0])) - 1;
+  while (distance_base[j] > distance) {
+    j--;
+  }
+  put_code(j, 5);
+  put_bits(distance - distance_base[j], distance_extra[j]);
+}
+
+void GzipCompressor::begin_member() {
+  _crc = 0;
+  _input_size = 0;
+  _bit_buffer = 0;
+  _bit_count = 0;
+
+  static const u1 header[] = {
+    0x1f, 0x8b,             // magic
+    8,                      // deflate
+    0,                      // flags
+    0, 0, 0, 0,             // modification time
+    0,                      // extra flags
+    255                     // unknown OS
+  };
+  ensure_output(sizeof(header));
+  for (size_t i = 0; i < sizeof(header); i++) {
+    put_byte(header[i]);
+  }
+}
+
+void GzipCompressor::compress(const u1* in, size_t len, bool last) {
+  assert(len <= (size_t)max_jint, "chunk too large");
+  // Literals take at most 9 bits, plus the block header, end of block
+  // code and trailer.
+  ensure_output(len + len / 8 + 16);
+
+  if (len > 0) {
+    _crc = ClassLoader::crc32(_crc, (const char*)in, (int)len);
+  }
+  _input_size += (juint)len;
+
+  // A block using the fixed Huffman codes.
+  put_bits(last ? 1 : 0, 1);
+  put_bits(1, 2);
+
+  for (int i = 0; i < hash_size; i++) {
+    _head[i] = -1;
+  }
+
+  const int n = (int)len;
+  int pos = 0;
+  while (pos < n) {
+    int best_length = 0;
+    int best_distance = 0;
+    if (pos + min_match <= n) {
+      int limit = MIN2((int)max_match, n - pos);
+      juint h = ((in[pos] << 10) ^ (in[pos + 1] << 5) ^ in[pos + 2]) & (hash_size - 1);
+      int chain = _max_chain;
+      for (int cand = _head[h];
+           cand >= 0 && pos - cand <= window_size && chain-- > 0;
+           cand = _prev[cand & window_mask]) {
+        if (in[cand + best_length] != in[pos + best_length]) {
+          continue;
+        }
+        int l = 0;
+        while (l < limit && in[cand + l] == in[pos + l]) {
+          l++;
+        }
+        if (l > best_length) {
+          best_length = l;
+          best_distance = pos - cand;
+          if (l == limit) {
+            break;
+          }
+        }
+      }
+      _prev[pos & window_mask] = _head[h];
+      _head[h] = pos;
+    }
+
+    if (best_length >= min_match) {
+      put_match(best_length, best_distance);
+      // Make the positions inside the match available to later matches.
+      for (int i = pos + 1; i < pos + best_length && i + min_match <= n; i++) {
+        juint h = ((in[i] << 10) ^ (in[i + 1] << 5) ^ in[i + 2]) & (hash_size - 1);
+        _prev[i & window_mask] = _head[h];
+        _head[h] = i;
+      }
+      pos += best_length;
+    } else {
+      put_literal(in[pos]);
+      pos++;
+    }
+  }
+
+  // End of block.
+  put_code(0, 7);
+
+  if (last) {
+    flush_bits();
+    juint crc = (juint)_crc;
+    for (int i = 0; i < 4; i++) {
+      put_byte((u1)(crc >> (8 * i)));
+    }
+    for (int i = 0; i < 4; i++) {
+      put_byte((u1)(_input_size >> (8 * i)));
+    }
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_SERVICES_HEAPDUMPERCOMPRESSION_HPP
+#define SHARE_VM_SERVICES_HEAPDUMPERCOMPRESSION_HPP
+
+#include "memory/allocation.hpp"
+
+// GzipCompressor produces gzip (RFC 1952) members using a small deflate
+// (RFC 1951) encoder. The JDK's zlib is not available to the VM, so the
+// encoder only emits blocks with the fixed Huffman codes; matches are
+// found with a hash chain whose length grows with the compression level.
+// The window is reset at the start of each chunk passed to compress().
+//
+//  { GzipCompressor c(level);
+//    c.begin_member();
+//    while (...) {
+//      c.compress(buf, len, last);
+//      write(c.output(), c.output_length());
+//      c.reset_output();
+//    }
+//  }
+
+class GzipCompressor : public CHeapObj<mtInternal> {
+ private:
+  enum {
+    window_size  = 32 * K,
+    window_mask  = window_size - 1,
+    hash_bits    = 15,
+    hash_size    = 1 << hash_bits,
+    min_match    = 3,
+    max_match    = 258
+  };
+
+  int      _max_chain;      // hash chain entries tried for each match
+  int*     _head;           // most recent position for each hash
+  int*     _prev;           // previous position with the same hash
+
+  u1*      _out;            // output buffer
+  size_t   _out_capacity;
+  size_t   _out_length;
+  juint    _bit_buffer;     // pending output bits, least significant first
+  int      _bit_count;
+
+  int      _crc;            // CRC-32 of the uncompressed member data
+  juint    _input_size;     // uncompressed member size, modulo 2^32
+
+  void ensure_output(size_t len);
+  void put_byte(u1 b)       { _out[_out_length++] = b; }
+  void put_bits(juint value, int count);
+  void put_code(juint code, int length);
+  void flush_bits();
+
+  void put_literal(int literal);
+  void put_match(int length, int distance);
+
+ public:
+  GzipCompressor(uint level);
+  ~GzipCompressor();
+
+  // Writes the gzip member header.
+  void begin_member();
+
+  // Compresses "len" bytes of member data. The member trailer follows
+  // the data if "last" is set.
+  void compress(const u1* in, size_t len, bool last);
+
+  // Compressed bytes produced since the last call to reset_output().
+  const u1* output() const      { return _out; }
+  size_t output_length() const  { return _out_length; }
+  void reset_output()           { _out_length = 0; }
+};
+
+#endif // SHARE_VM_SERVICES_HEAPDUMPERCOMPRESSION_HPP
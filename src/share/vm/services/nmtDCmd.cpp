@@ -23,7 +23,9 @@
  */
 #include "precompiled.hpp"
 
+#include "classfile/classLoaderStats.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/vmThread.hpp"
 #include "services/nmtDCmd.hpp"
 #include "services/memReporter.hpp"
 #include "services/memTracker.hpp"
@@ -53,6 +55,9 @@ NMTDCmd::NMTDCmd(outputStream* output,
             "BOOLEAN", false, "false"),
   _statistics("statistics", "print tracker statistics for tuning purpose.", \
             "BOOLEAN", false, "false"),
+  _metaspace("metaspace", "with detail, also report Metaspace usage by " \
+            "class loader. This requires a safepoint.",
+            "BOOLEAN", false, "false"),
   _scale("scale", "Memory usage in which scale, KB, MB or GB",
        "STRING", false, "KB") {
   _dcmdparser.add_dcmd_option(&_summary);
@@ -62,6 +67,7 @@ NMTDCmd::NMTDCmd(outputStream* output,
   _dcmdparser.add_dcmd_option(&_detail_diff);
   _dcmdparser.add_dcmd_option(&_shutdown);
   _dcmdparser.add_dcmd_option(&_statistics);
+  _dcmdparser.add_dcmd_option(&_metaspace);
   _dcmdparser.add_dcmd_option(&_scale);
 }
 
@@ -178,6 +184,15 @@ void NMTDCmd::report(bool summaryOnly, size_t scale_unit) {
     } else {
       MemDetailReporter rpt(baseline, output(), scale_unit);
       rpt.report();
+
+      // Break the Class category down by class loader: the committed
+      // Metaspace chunks (ChunkSz) and the metadata in them (BlockSz).
+      // Walking the class loaders needs a safepoint, so only on request.
+      if (_metaspace.value()) {
+        output()->print_cr("Metaspace by class loader:");
+        ClassLoaderStatsVMOperation op(output());
+        VMThread::execute(&op);
+      }
     }
   }
 }
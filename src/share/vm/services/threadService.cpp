@@ -30,6 +30,7 @@
 #include "oops/instanceKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/init.hpp"
 #include "runtime/thread.hpp"
 #include "runtime/vframe.hpp"
@@ -238,6 +239,28 @@ void ThreadService::remove_thread_dump(ThreadDumpResult* dump) {
   assert(found, "The threaddump result to be removed must exist.");
 }
 
+// Records the entire stack of a single thread while it is stopped in a
+// thread-local handshake.
+class GetSingleStackTraceClosure : public ThreadClosure {
+  ThreadSnapshot* _snapshot;
+
+ public:
+  GetSingleStackTraceClosure(ThreadSnapshot* snapshot) : _snapshot(snapshot) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = (JavaThread*) thread;
+    // Dump thread stack only if the thread is not exiting and not VM
+    // internal thread; otherwise leave the snapshot empty.
+    if (jt->is_exiting() || jt->is_hidden_from_external_view()) {
+      return;
+    }
+    ResourceMark rm;
+    ThreadStackTrace* stacktrace = new ThreadStackTrace(jt, false);
+    stacktrace->dump_stack_at_safepoint(-1);
+    _snapshot->set_stack_trace(stacktrace);
+  }
+};
+
 // Dump stack trace of threads specified in the given threads array.
 // Returns StackTraceElement[][] each element is the stack trace of a thread in
 // the corresponding entry in the given threads array
@@ -247,13 +270,26 @@ Handle ThreadService::dump_stack_traces(GrowableArray<instanceHandle>* threads,
   assert(num_threads > 0, "just checking");
 
   ThreadDumpResult dump_result;
-  VM_ThreadDump op(&dump_result,
-                   threads,
-                   num_threads,
-                   -1,    /* entire stack */
-                   false, /* with locked monitors */
-                   false  /* with locked synchronizers */);
-  VMThread::execute(&op);
+  if (ThreadLocalHandshakes && num_threads == 1) {
+    // Thread.getStackTrace() only has to stop the thread being sampled.
+    ThreadSnapshot* snapshot = new ThreadSnapshot();
+    dump_result.add_thread_snapshot(snapshot);
+    instanceHandle th = threads->at(0);
+    if (th() != NULL) {
+      // The JavaThread is looked up inside the handshake operation, where it
+      // cannot exit underneath us.
+      GetSingleStackTraceClosure cl(snapshot);
+      Handshake::execute(&cl, th);
+    }
+  } else {
+    VM_ThreadDump op(&dump_result,
+                     threads,
+                     num_threads,
+                     -1,    /* entire stack */
+                     false, /* with locked monitors */
+                     false  /* with locked synchronizers */);
+    VMThread::execute(&op);
+  }
 
   // Allocate the resulting StackTraceElement[][] object
 
@@ -555,7 +591,8 @@ ThreadStackTrace::~ThreadStackTrace() {
 }
 
 void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  assert(SafepointSynchronize::is_at_safepoint() || _thread == Thread::current() ||
+         _thread->is_handshake_processing(), "thread must be stopped");
 
   if (_thread->has_last_Java_frame()) {
     RegisterMap reg_map(_thread);
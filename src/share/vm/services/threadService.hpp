@@ -242,6 +242,7 @@ public:
 
   void        dump_stack_at_safepoint(int max_depth, bool with_locked_monitors);
   void        set_concurrent_locks(ThreadConcurrentLocks* l) { _concurrent_locks = l; }
+  void        set_stack_trace(ThreadStackTrace* st) { _stack_trace = st; }
   void        oops_do(OopClosure* f);
   void        metadata_do(void f(Metadata*));
 };
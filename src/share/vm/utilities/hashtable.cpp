@@ -94,9 +94,18 @@ template <class T, MEMFLAGS F> bool RehashableHashtable<T, F>::check_rehash_tabl
   return false;
 }
 
+// Check to see if the average bucket length has grown past grow_load_factor.
+// The caller sets a flag to move the elements into a larger table at the
+// next safepoint, since the lock-free readers of the table only stop there.
+
+template <class T, MEMFLAGS F> bool RehashableHashtable<T, F>::check_grow_table() {
+  return this->table_size() < max_table_size &&
+         this->number_of_entries() > this->table_size() * grow_load_factor;
+}
+
 // Create a new table and using alternate hash code, populate the new table
 // with the existing elements.   This can be used to change the hash code
-// and could in the future change the size of the table.
+// and the size of the table.
 
 template <class T, MEMFLAGS F> void RehashableHashtable<T, F>::move_to(RehashableHashtable<T, F>* new_table) {
 
@@ -104,18 +113,33 @@ template <class T, MEMFLAGS F> void RehashableHashtable<T, F>::move_to(Rehashabl
   _seed = AltHashing::compute_seed();
   assert(seed() != 0, "shouldn't be zero");
 
+  move_entries_to(new_table, true);
+}
+
+// Populate a new table of a different size with the existing elements.
+// The hash values stay the same, only the bucket indices change.
+
+template <class T, MEMFLAGS F> void RehashableHashtable<T, F>::resize_to(RehashableHashtable<T, F>* new_table) {
+  move_entries_to(new_table, false);
+}
+
+template <class T, MEMFLAGS F> void RehashableHashtable<T, F>::move_entries_to(RehashableHashtable<T, F>* new_table, bool rehash) {
+  assert(SafepointSynchronize::is_at_safepoint(), "readers of the table are unlocked");
+
   int saved_entry_count = this->number_of_entries();
 
   // Iterate through the table and create a new entry for the new table
-  for (int i = 0; i < new_table->table_size(); ++i) {
+  for (int i = 0; i < this->table_size(); ++i) {
     for (HashtableEntry<T, F>* p = this->bucket(i); p != NULL; ) {
       HashtableEntry<T, F>* next = p->next();
-      T string = p->literal();
-      // Use alternate hashing algorithm on the symbol in the first table
-      unsigned int hashValue = string->new_hash(seed());
+      unsigned int hashValue = p->hash();
+      if (rehash) {
+        // Use alternate hashing algorithm on the symbol in the first table
+        hashValue = p->literal()->new_hash(seed());
+        p->set_hash(hashValue);
+      }
       // Get a new index relative to the new table (can also change size)
       int index = new_table->hash_to_index(hashValue);
-      p->set_hash(hashValue);
       // Keep the shared bit in the Hashtable entry to indicate that this entry
       // can't be deleted.   The shared bit is the LSB in the _next field so
       // walking the hashtable past these entries requires
@@ -297,12 +297,22 @@ template <class T, MEMFLAGS F> class RehashableHashtable : public Hashtable<T, F
 
   enum {
     rehash_count = 100,
-    rehash_multiple = 60
+    rehash_multiple = 60,
+    grow_load_factor = 2,     // average bucket length that triggers growing
+    max_table_size = 1 << 24
   };
 
   // Check that the table is unbalanced
   bool check_rehash_table(int count);
 
+  // Check that the table holds too many entries for its number of buckets
+  bool check_grow_table();
+
+  // The size of the table the elements are moved into when growing
+  int grown_table_size() {
+    return MIN2(this->table_size() * 2 + 1, (int)max_table_size);
+  }
+
  public:
   RehashableHashtable(int table_size, int entry_size)
     : Hashtable<T, F>(table_size, entry_size) { }
@@ -314,6 +324,9 @@ template <class T, MEMFLAGS F> class RehashableHashtable : public Hashtable<T, F
 
   // Function to move these elements into the new table.
   void move_to(RehashableHashtable<T, F>* new_table);
+  // Function to move these elements into a new table of a different
+  // size, keeping their hash values.
+  void resize_to(RehashableHashtable<T, F>* new_table);
   static bool use_alternate_hashcode();
   static juint seed();
 
@@ -331,6 +344,8 @@ template <class T, MEMFLAGS F> class RehashableHashtable : public Hashtable<T, F
 
  private:
   static juint _seed;
+
+  void move_entries_to(RehashableHashtable<T, F>* new_table, bool rehash);
 };
 
 template <class T, MEMFLAGS F> juint RehashableHashtable<T, F>::_seed = 0;
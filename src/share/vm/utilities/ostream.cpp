@@ -27,6 +27,7 @@
 #include "gc_implementation/shared/gcId.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/asyncLogWriter.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/vmThread.hpp"
@@ -1412,6 +1413,7 @@ void ostream_exit() {
 // ostream_abort() is called by os::abort() when VM is about to die.
 void ostream_abort() {
   // Here we can't delete gclog_or_tty and tty, just flush their output
+  AsyncLogWriter::flush(false /* wait */);
   if (gclog_or_tty) gclog_or_tty->flush();
   if (tty) tty->flush();
 
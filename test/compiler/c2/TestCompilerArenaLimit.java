@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary C2 bails out and marks the method not compilable once a compilation exceeds -XX:CompilerArenaLimit
+ * @library /testlibrary /testlibrary/whitebox/
+ * @build sun.hotspot.WhiteBox
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -Xbatch -XX:-TieredCompilation -XX:CompilerArenaLimit=65536
+ *      TestCompilerArenaLimit false
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -Xbatch -XX:-TieredCompilation -XX:CompilerArenaLimit=0
+ *      TestCompilerArenaLimit true
+ */
+
+import java.lang.reflect.Method;
+import sun.hotspot.WhiteBox;
+
+public class TestCompilerArenaLimit {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int COMP_LEVEL_FULL_OPTIMIZATION = 4;
+
+    static int test(int[] a) {
+        int r = 0;
+        for (int i = 0; i < a.length; i++) {
+            r = r * 31 + a[i];
+        }
+        return r;
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean expectCompiled = Boolean.parseBoolean(args[0]);
+        Method m = TestCompilerArenaLimit.class.getDeclaredMethod("test", int[].class);
+
+        int[] a = new int[100];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i;
+        }
+        int expected = test(a);
+        for (int i = 0; i < 20000; i++) {
+            int r = test(a);
+            if (r != expected) {
+                throw new RuntimeException("Wrong result " + r + ", expected " + expected);
+            }
+        }
+        WB.enqueueMethodForCompilation(m, COMP_LEVEL_FULL_OPTIMIZATION);
+
+        boolean compilable = WB.isMethodCompilable(m, COMP_LEVEL_FULL_OPTIMIZATION);
+        boolean compiled = WB.isMethodCompiled(m);
+        if (compilable != expectCompiled || compiled != expectCompiled) {
+            throw new RuntimeException("Expected compilable and compiled to be " + expectCompiled +
+                                       " but got compilable=" + compilable + " compiled=" + compiled);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Block layout with uncommon blocks moved behind the hot code
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+SplitColdBlocks
+ *      -XX:CompileCommand=exclude,compiler.c2.TestSplitColdBlocks::ref*
+ *      compiler.c2.TestSplitColdBlocks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+UnlockDiagnosticVMOptions -XX:-SplitColdBlocks
+ *      -XX:CompileCommand=exclude,compiler.c2.TestSplitColdBlocks::ref*
+ *      compiler.c2.TestSplitColdBlocks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+SplitColdBlocks -XX:-BlockLayoutByFrequency
+ *      -XX:CompileCommand=exclude,compiler.c2.TestSplitColdBlocks::ref*
+ *      compiler.c2.TestSplitColdBlocks
+ * @run main compiler.c2.TestSplitColdBlocks trace
+ */
+
+package compiler.c2;
+
+import opto.TraceCheck;
+
+public class TestSplitColdBlocks {
+    static final int ITERS = 20000;
+
+    // Hot loop with rarely taken exception, null check and type check paths.
+    static long test(Object[] a, int[] idx) {
+        long r = 0;
+        for (int i = 0; i < idx.length; i++) {
+            try {
+                Object o = a[idx[i]];
+                if (o == null) {
+                    r -= 7;
+                } else if (o instanceof Integer) {
+                    r += (Integer)o;
+                } else {
+                    r ^= o.hashCode();
+                }
+            } catch (ArrayIndexOutOfBoundsException e) {
+                r += 1000;
+            }
+        }
+        return r;
+    }
+
+    // Reference version, never compiled (see CompileCommand above).
+    static long refTest(Object[] a, int[] idx) {
+        long r = 0;
+        for (int i = 0; i < idx.length; i++) {
+            try {
+                Object o = a[idx[i]];
+                if (o == null) {
+                    r -= 7;
+                } else if (o instanceof Integer) {
+                    r += (Integer)o;
+                } else {
+                    r ^= o.hashCode();
+                }
+            } catch (ArrayIndexOutOfBoundsException e) {
+                r += 1000;
+            }
+        }
+        return r;
+    }
+
+    static void check(long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+
+    // The runs above also pass if the layout is unchanged. Check in a
+    // debug VM that the cold paths of test() are moved out of line.
+    static void verifyTrace() throws Exception {
+        TraceCheck.verify("SplitColdBlocks: [1-9]\\d* of", TestSplitColdBlocks.class,
+                          "-Xbatch", "-XX:-TieredCompilation",
+                          "-XX:CompileCommand=compileonly,compiler.c2.TestSplitColdBlocks::test",
+                          "-XX:+PrintSplitColdBlocks");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyTrace();
+            return;
+        }
+        Object[] a = new Object[64];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = Integer.valueOf(i * 31);
+        }
+        int[] idx = new int[100];
+        for (int i = 0; i < idx.length; i++) {
+            idx[i] = (i * 7) % a.length;
+        }
+        for (int iter = 0; iter < ITERS; iter++) {
+            check(refTest(a, idx), test(a, idx));
+        }
+
+        // Now take the cold paths from compiled code.
+        a[3] = null;
+        a[5] = "cold";
+        idx[10] = a.length + 1;
+        for (int iter = 0; iter < 100; iter++) {
+            check(refTest(a, idx), test(a, idx));
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Scalar replacement of non-escaping allocations merged by a Phi
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:CompileCommand=exclude,compiler.escapeAnalysis.TestReduceAllocationMerges::ref*
+ *      compiler.escapeAnalysis.TestReduceAllocationMerges
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-ReduceAllocationMerges
+ *      -XX:CompileCommand=exclude,compiler.escapeAnalysis.TestReduceAllocationMerges::ref*
+ *      compiler.escapeAnalysis.TestReduceAllocationMerges
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseCompressedOops
+ *      -XX:CompileCommand=exclude,compiler.escapeAnalysis.TestReduceAllocationMerges::ref*
+ *      compiler.escapeAnalysis.TestReduceAllocationMerges
+ * @run main compiler.escapeAnalysis.TestReduceAllocationMerges trace
+ */
+
+package compiler.escapeAnalysis;
+
+import opto.TraceCheck;
+
+public class TestReduceAllocationMerges {
+    static final int ITERS = 20000;
+
+    static class Point {
+        int x;
+        int y;
+        Object tag;
+        Point(int x, int y, Object tag) { this.x = x; this.y = y; this.tag = tag; }
+    }
+
+    static volatile boolean deopt;
+    static Object sink;
+
+    static int merge(boolean c, int a, int b) {
+        Point p;
+        if (c) {
+            p = new Point(a, b, "first");
+        } else {
+            p = new Point(b, a, null);
+        }
+        return p.x * 31 + p.y;
+    }
+
+    static int mergeThree(int k, int a) {
+        Point p;
+        if (k == 0) {
+            p = new Point(a, 1, null);
+        } else if (k == 1) {
+            p = new Point(2, a, null);
+        } else {
+            p = new Point(a, a, null);
+        }
+        return p.x - p.y;
+    }
+
+    // The merged object is live in the debug info of the uncommon
+    // trap and has to be reallocated with the merged field values.
+    static int mergeDeopt(boolean c, int a, int b) {
+        Point p = c ? new Point(a, b, "first") : new Point(b, a, "second");
+        if (deopt) {
+            sink = p.tag;
+            return p.x + p.y + 1;
+        }
+        return p.x + p.y;
+    }
+
+    // Reference versions, never compiled (see CompileCommand above).
+    static int refMerge(boolean c, int a, int b) {
+        return c ? a * 31 + b : b * 31 + a;
+    }
+
+    static int refMergeThree(int k, int a) {
+        return k == 0 ? a - 1 : (k == 1 ? 2 - a : 0);
+    }
+
+    static int refMergeDeopt(boolean c, int a, int b) {
+        return deopt ? a + b + 1 : a + b;
+    }
+
+    static void check(String name, int expected, int actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    // The runs above also pass if nothing is scalar replaced. Check in a
+    // debug VM that the merges are reduced and the allocations go away.
+    static void verifyTrace() throws Exception {
+        String compileOnly = "-XX:CompileCommand=compileonly,compiler.escapeAnalysis.TestReduceAllocationMerges::merge*";
+        TraceCheck.verify("=== Reduce allocation merge", TestReduceAllocationMerges.class,
+                          "-Xbatch", "-XX:-TieredCompilation", compileOnly,
+                          "-XX:+PrintReduceAllocationMerges");
+        TraceCheck.verify("\\+\\+\\+\\+ Eliminated: \\d+ Allocate", TestReduceAllocationMerges.class,
+                          "-Xbatch", "-XX:-TieredCompilation", compileOnly,
+                          "-XX:+PrintEliminateAllocations");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyTrace();
+            return;
+        }
+        for (int i = 0; i < ITERS; i++) {
+            boolean c = (i & 1) == 0;
+            check("merge", refMerge(c, i, i >> 2), merge(c, i, i >> 2));
+            check("mergeThree", refMergeThree(i % 3, i), mergeThree(i % 3, i));
+            check("mergeDeopt", refMergeDeopt(c, i, 7), mergeDeopt(c, i, 7));
+        }
+        deopt = true;
+        check("mergeDeopt", refMergeDeopt(true, 5, 7), mergeDeopt(true, 5, 7));
+        if (!"first".equals(sink)) {
+            throw new RuntimeException("mergeDeopt: wrong tag " + sink);
+        }
+        check("mergeDeopt", refMergeDeopt(false, 5, 7), mergeDeopt(false, 5, 7));
+        if (!"second".equals(sink)) {
+            throw new RuntimeException("mergeDeopt: wrong tag " + sink);
+        }
+    }
+}
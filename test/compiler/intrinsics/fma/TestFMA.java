@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Math.fma intrinsics and their SuperWord vectorization
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch TestFMA
+ * @run main/othervm -Xbatch -XX:-UseSuperWord TestFMA
+ * @run main/othervm -Xbatch -XX:-UseFMA TestFMA
+ * @run main TestFMA trace
+ */
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.math.BigDecimal;
+
+import opto.TraceCheck;
+
+public class TestFMA {
+    static final int ITERS = 20000;
+
+    // Math.fma only exists on newer class libraries; look it up so the
+    // test compiles and quietly passes everywhere else.
+    static final MethodHandle FMA_D = lookup(double.class);
+    static final MethodHandle FMA_F = lookup(float.class);
+
+    static MethodHandle lookup(Class<?> t) {
+        try {
+            return MethodHandles.lookup().findStatic(Math.class, "fma", MethodType.methodType(t, t, t, t));
+        } catch (ReflectiveOperationException e) {
+            return null;
+        }
+    }
+
+    static double fmaD(double a, double b, double c) throws Throwable {
+        return (double) FMA_D.invokeExact(a, b, c);
+    }
+
+    static float fmaF(float a, float b, float c) throws Throwable {
+        return (float) FMA_F.invokeExact(a, b, c);
+    }
+
+    static void fmaD(double[] a, double[] b, double[] c) throws Throwable {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (double) FMA_D.invokeExact(a[i], b[i], c[i]);
+        }
+    }
+
+    static void fmaF(float[] a, float[] b, float[] c) throws Throwable {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (float) FMA_F.invokeExact(a[i], b[i], c[i]);
+        }
+    }
+
+    // Exact product and sum, rounded once.
+    static double refD(double a, double b, double c) {
+        return new BigDecimal(a).multiply(new BigDecimal(b)).add(new BigDecimal(c)).doubleValue();
+    }
+
+    static float refF(float a, float b, float c) {
+        return new BigDecimal(a).multiply(new BigDecimal(b)).add(new BigDecimal(c)).floatValue();
+    }
+
+    static void check(String name, double expected, double actual) {
+        if (Double.doubleToRawLongBits(expected) != Double.doubleToRawLongBits(actual)) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    // The runs above also pass without the intrinsic. Check that C2 uses
+    // it wherever UseFMA is on.
+    static void verifyIntrinsic() throws Exception {
+        TraceCheck.verifyIntrinsic("UseFMA", "Math::fma \\(\\d+ bytes\\)\\s+\\(intrinsic", TestFMA.class);
+    }
+
+    public static void main(String[] args) throws Throwable {
+        if (FMA_D == null || FMA_F == null) {
+            System.out.println("Math.fma is not available, skipping");
+            return;
+        }
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyIntrinsic();
+            return;
+        }
+
+        // 1 + 2^-52 squared minus 1 is 2^-51 + 2^-104 exactly; the
+        // unfused computation loses the low term.
+        double x = 1.0 + Math.ulp(1.0);
+        float xf = 1.0f + Math.ulp(1.0f);
+        for (int i = 0; i < ITERS; i++) {
+            check("fmaD", refD(x, x, -1.0), fmaD(x, x, -1.0));
+            check("fmaF", refF(xf, xf, -1.0f), fmaF(xf, xf, -1.0f));
+        }
+
+        int len = 1027;
+        double[] ad = new double[len];
+        double[] bd = new double[len];
+        double[] cd = new double[len];
+        double[] ed = new double[len];
+        float[] af = new float[len];
+        float[] bf = new float[len];
+        float[] cf = new float[len];
+        float[] ef = new float[len];
+        for (int i = 0; i < len; i++) {
+            ad[i] = 1.0 + i * Math.ulp(1.0);
+            bd[i] = 1.0 - i * Math.ulp(1.0);
+            af[i] = 1.0f + i * Math.ulp(1.0f);
+            bf[i] = 1.0f - i * Math.ulp(1.0f);
+        }
+        for (int iter = 0; iter < ITERS / 100; iter++) {
+            for (int i = 0; i < len; i++) {
+                cd[i] = -1.0 - iter;
+                cf[i] = -1.0f - iter;
+                ed[i] = refD(ad[i], bd[i], cd[i]);
+                ef[i] = refF(af[i], bf[i], cf[i]);
+            }
+            fmaD(ad, bd, cd);
+            fmaF(af, bf, cf);
+            for (int i = 0; i < len; i++) {
+                check("fmaD[" + i + "]", ed[i], cd[i]);
+                check("fmaF[" + i + "]", ef[i], cf[i]);
+            }
+        }
+    }
+}
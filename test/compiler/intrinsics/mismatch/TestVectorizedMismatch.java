@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Verify the vectorizedMismatch intrinsic against the Java version for every mismatch position
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck java.util.ArraysSupport
+ * @run main/bootclasspath/othervm -Xbatch TestVectorizedMismatch
+ * @run main/bootclasspath/othervm -Xbatch -XX:TieredStopAtLevel=1 TestVectorizedMismatch
+ * @run main/bootclasspath/othervm -Xbatch -XX:-TieredCompilation TestVectorizedMismatch
+ * @run main/bootclasspath/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:UseAVX=0 TestVectorizedMismatch
+ * @run main/bootclasspath/othervm -Xbatch -XX:-UseVectorizedMismatchIntrinsic TestVectorizedMismatch
+ * @run main/bootclasspath TestVectorizedMismatch trace
+ */
+
+import java.lang.reflect.Field;
+import java.util.ArraysSupport;
+import sun.misc.Unsafe;
+
+import opto.TraceCheck;
+
+public class TestVectorizedMismatch {
+    static final Unsafe U;
+
+    static {
+        try {
+            Field f = Unsafe.class.getDeclaredField("theUnsafe");
+            f.setAccessible(true);
+            U = (Unsafe) f.get(null);
+        } catch (Exception e) {
+            throw new Error(e);
+        }
+    }
+
+    static final long BYTE_BASE = U.arrayBaseOffset(byte[].class);
+    static final long CHAR_BASE = U.arrayBaseOffset(char[].class);
+    static final long INT_BASE  = U.arrayBaseOffset(int[].class);
+    static final long LONG_BASE = U.arrayBaseOffset(long[].class);
+
+    static int mismatch(byte[] a, byte[] b, int from, int len) {
+        return ArraysSupport.vectorizedMismatch(a, BYTE_BASE + from, b, BYTE_BASE + from, len, 0);
+    }
+
+    static int mismatch(char[] a, char[] b, int len) {
+        return ArraysSupport.vectorizedMismatch(a, CHAR_BASE, b, CHAR_BASE, len, 1);
+    }
+
+    static int mismatch(int[] a, int[] b, int len) {
+        return ArraysSupport.vectorizedMismatch(a, INT_BASE, b, INT_BASE, len, 2);
+    }
+
+    static int mismatch(long[] a, long[] b, int len) {
+        return ArraysSupport.vectorizedMismatch(a, LONG_BASE, b, LONG_BASE, len, 3);
+    }
+
+    static void check(String name, int len, int pos, int expected, int actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + " length " + len + " mismatch at " + pos +
+                                       ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    static void test(int len) {
+        byte[] ba = new byte[len + 3];
+        char[] ca = new char[len];
+        int[]  ia = new int[len];
+        long[] la = new long[len];
+        for (int i = 0; i < len; i++) {
+            ba[i] = (byte) i;
+            ca[i] = (char) (i * 31);
+            ia[i] = i * 0x9E3779B1;
+            la[i] = (long) ia[i] << 13;
+        }
+        byte[] bb = ba.clone();
+        char[] cb = ca.clone();
+        int[]  ib = ia.clone();
+        long[] lb = la.clone();
+
+        check("equal byte[]", len, -1, -1, mismatch(ba, bb, 0, len));
+        check("equal char[]", len, -1, -1, mismatch(ca, cb, len));
+        check("equal int[]",  len, -1, -1, mismatch(ia, ib, len));
+        check("equal long[]", len, -1, -1, mismatch(la, lb, len));
+
+        for (int pos = 0; pos < len; pos++) {
+            // Differ in a single bit of the highest byte, so every byte of
+            // the element is looked at.
+            bb[pos] ^= (byte) 0x80;
+            cb[pos] ^= (char) 0x8000;
+            ib[pos] ^= 0x80000000;
+            lb[pos] ^= 0x8000000000000000L;
+            check("byte[]", len, pos, pos, mismatch(ba, bb, 0, len));
+            check("char[]", len, pos, pos, mismatch(ca, cb, len));
+            check("int[]",  len, pos, pos, mismatch(ia, ib, len));
+            check("long[]", len, pos, pos, mismatch(la, lb, len));
+            // Misaligned start.
+            if (pos >= 3) {
+                check("byte[] at 3", len, pos, pos - 3, mismatch(ba, bb, 3, len));
+            }
+            bb[pos] ^= (byte) 0x80;
+            cb[pos] ^= (char) 0x8000;
+            ib[pos] ^= 0x80000000;
+            lb[pos] ^= 0x8000000000000000L;
+        }
+    }
+
+    // The runs above also pass without the intrinsic. Check that C2 uses
+    // it wherever UseVectorizedMismatchIntrinsic is on.
+    static void verifyIntrinsic() throws Exception {
+        TraceCheck.verifyIntrinsic("UseVectorizedMismatchIntrinsic",
+                                   "ArraysSupport::vectorizedMismatch \\(\\d+ bytes\\)\\s+\\(intrinsic",
+                                   TestVectorizedMismatch.class,
+                                   "-Xbootclasspath/a:" + System.getProperty("test.classes"));
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyIntrinsic();
+            return;
+        }
+        for (int iter = 0; iter < 20; iter++) {
+            for (int len = 0; len <= 80; len++) {
+                test(len);
+            }
+        }
+        test(1000);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Verify the Adler32 intrinsic against a Java version for byte arrays and direct buffers
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch TestAdler32
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1 TestAdler32
+ * @run main/othervm -Xbatch -XX:-TieredCompilation TestAdler32
+ * @run main/othervm -Xint TestAdler32
+ * @run main/othervm -Xbatch -XX:-UseAdler32Intrinsics TestAdler32
+ * @run main TestAdler32 trace
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.Adler32;
+
+import opto.TraceCheck;
+
+public class TestAdler32 {
+    static final int BASE = 65521;
+
+    static int refAdler32(int adler, byte[] b, int off, int len) {
+        int s1 = adler & 0xffff;
+        int s2 = adler >>> 16;
+        for (int i = off; i < off + len; i++) {
+            s1 = (s1 + (b[i] & 0xff)) % BASE;
+            s2 = (s2 + s1) % BASE;
+        }
+        return (s2 << 16) | s1;
+    }
+
+    static void check(String name, int len, int off, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + " length " + len + " offset " + off +
+                                       ": expected " + Long.toHexString(expected) +
+                                       " but got " + Long.toHexString(actual));
+        }
+    }
+
+    static void test(byte[] data, ByteBuffer direct, int off, int len) {
+        long expected = refAdler32(1, data, off, len) & 0xffffffffL;
+
+        Adler32 a = new Adler32();
+        a.update(data, off, len);
+        check("byte[]", len, off, expected, a.getValue());
+
+        direct.clear();
+        direct.position(off);
+        direct.limit(off + len);
+        a.reset();
+        a.update(direct);
+        check("direct", len, off, expected, a.getValue());
+    }
+
+    // The runs above also pass without the intrinsic. Check that C2 uses
+    // it wherever UseAdler32Intrinsics is on.
+    static void verifyIntrinsic() throws Exception {
+        TraceCheck.verifyIntrinsic("UseAdler32Intrinsics",
+                                   "Adler32::updateBytes \\(\\d+ bytes\\)\\s+\\(intrinsic",
+                                   TestAdler32.class);
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyIntrinsic();
+            return;
+        }
+        Random r = new Random(42);
+        // Larger than the 5552 byte block after which the sums are reduced.
+        byte[] data = new byte[3 * 5552 + 100];
+        r.nextBytes(data);
+        // All 0xff bytes give the largest intermediate sums.
+        for (int i = 0; i < 6000; i++) {
+            data[i] = (byte) 0xff;
+        }
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data);
+
+        int[] lengths = { 0, 1, 15, 16, 17, 31, 33, 100, 5551, 5552, 5553, 11104, 11120 };
+        for (int iter = 0; iter < 200; iter++) {
+            for (int len : lengths) {
+                int off = iter % 19;
+                test(data, direct, off, len);
+            }
+        }
+        test(data, direct, 0, data.length);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Verify the CRC32C intrinsic against a table driven version for byte arrays and direct buffers
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck java.util.zip.CRC32C
+ * @run main/bootclasspath/othervm -Xbatch TestCRC32C
+ * @run main/bootclasspath/othervm -Xbatch -XX:TieredStopAtLevel=1 TestCRC32C
+ * @run main/bootclasspath/othervm -Xbatch -XX:-TieredCompilation TestCRC32C
+ * @run main/bootclasspath/othervm -Xint TestCRC32C
+ * @run main/bootclasspath/othervm -Xbatch -XX:-UseCRC32CIntrinsics TestCRC32C
+ * @run main/bootclasspath TestCRC32C trace
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.CRC32C;
+
+import opto.TraceCheck;
+
+public class TestCRC32C {
+    // Reflected Castagnoli polynomial
+    static final int POLY = 0x82F63B78;
+
+    static long refCRC32C(byte[] b, int off, int len) {
+        int crc = 0xFFFFFFFF;
+        for (int i = off; i < off + len; i++) {
+            crc ^= b[i] & 0xff;
+            for (int k = 0; k < 8; k++) {
+                crc = (crc & 1) != 0 ? (crc >>> 1) ^ POLY : crc >>> 1;
+            }
+        }
+        return ~crc & 0xFFFFFFFFL;
+    }
+
+    static void check(String name, int len, int off, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + " length " + len + " offset " + off +
+                                       ": expected " + Long.toHexString(expected) +
+                                       " but got " + Long.toHexString(actual));
+        }
+    }
+
+    // The runs above also pass without the intrinsic. Check that C2 uses
+    // it wherever UseCRC32CIntrinsics is on.
+    static void verifyIntrinsic() throws Exception {
+        TraceCheck.verifyIntrinsic("UseCRC32CIntrinsics",
+                                   "CRC32C::updateBytes \\(\\d+ bytes\\)\\s+\\(intrinsic",
+                                   TestCRC32C.class,
+                                   "-Xbootclasspath/a:" + System.getProperty("test.classes"));
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyIntrinsic();
+            return;
+        }
+        Random r = new Random(42);
+        byte[] data = new byte[4096 + 64];
+        r.nextBytes(data);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data);
+
+        int[] lengths = { 0, 1, 7, 8, 9, 31, 32, 33, 100, 4096 };
+        for (int iter = 0; iter < 200; iter++) {
+            for (int len : lengths) {
+                int off = iter % 23;
+                long expected = refCRC32C(data, off, len);
+
+                CRC32C c = new CRC32C();
+                c.update(data, off, len);
+                check("byte[]", len, off, expected, c.getValue());
+
+                direct.clear();
+                direct.position(off);
+                direct.limit(off + len);
+                c.reset();
+                c.update(direct);
+                check("direct", len, off, expected, c.getValue());
+            }
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package java.util.zip;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Table driven CRC32C with the static update methods the VM intrinsifies.
+ * Loaded from the boot class path by the test.
+ */
+public final class CRC32C {
+    private static final int[] TABLE = new int[256];
+
+    static {
+        for (int n = 0; n < 256; n++) {
+            int c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) != 0 ? (c >>> 1) ^ 0x82F63B78 : c >>> 1;
+            }
+            TABLE[n] = c;
+        }
+    }
+
+    private int crc = 0xFFFFFFFF;
+
+    public void update(byte[] b, int off, int len) {
+        if (off < 0 || len < 0 || off > b.length - len) {
+            throw new ArrayIndexOutOfBoundsException();
+        }
+        crc = updateBytes(crc, b, off, off + len);
+    }
+
+    public void update(ByteBuffer buffer) {
+        int pos = buffer.position();
+        int limit = buffer.limit();
+        if (pos >= limit) {
+            return;
+        }
+        if (buffer.isDirect()) {
+            long address = ((sun.nio.ch.DirectBuffer) buffer).address();
+            crc = updateDirectByteBuffer(crc, address, pos, limit);
+        } else {
+            byte[] b = new byte[limit - pos];
+            buffer.duplicate().get(b);
+            crc = updateBytes(crc, b, 0, b.length);
+        }
+        buffer.position(limit);
+    }
+
+    public void reset() {
+        crc = 0xFFFFFFFF;
+    }
+
+    public long getValue() {
+        return ~crc & 0xFFFFFFFFL;
+    }
+
+    private static int updateBytes(int crc, byte[] b, int off, int end) {
+        for (int i = off; i < end; i++) {
+            crc = (crc >>> 8) ^ TABLE[(crc ^ b[i]) & 0xff];
+        }
+        return crc;
+    }
+
+    private static int updateDirectByteBuffer(int crc, long address, int off, int end) {
+        sun.misc.Unsafe u = UnsafeHolder.U;
+        for (int i = off; i < end; i++) {
+            crc = (crc >>> 8) ^ TABLE[(crc ^ u.getByte(address + i)) & 0xff];
+        }
+        return crc;
+    }
+
+    private static final class UnsafeHolder {
+        static final sun.misc.Unsafe U;
+
+        static {
+            try {
+                java.lang.reflect.Field f = sun.misc.Unsafe.class.getDeclaredField("theUnsafe");
+                f.setAccessible(true);
+                U = (sun.misc.Unsafe) f.get(null);
+            } catch (Exception e) {
+                throw new Error(e);
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Loops with a long induction variable are converted into a loop nest with an inner int counted loop
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:CompileCommand=exclude,compiler.loopopts.TestLongLoopStripMining::ref*
+ *      compiler.loopopts.TestLongLoopStripMining
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *      -XX:+UnlockDiagnosticVMOptions -XX:-StripMineLongLoops
+ *      -XX:CompileCommand=exclude,compiler.loopopts.TestLongLoopStripMining::ref*
+ *      compiler.loopopts.TestLongLoopStripMining
+ * @run main compiler.loopopts.TestLongLoopStripMining trace
+ */
+
+package compiler.loopopts;
+
+import opto.TraceCheck;
+
+public class TestLongLoopStripMining {
+    static final int ITERS = 5000;
+    static final int WIDE_ITERS = 1000;
+
+    // Constant stride of the wide loops below. They run over more than
+    // max_jint values so that the inner loop is entered several times.
+    static final int WIDE_STRIDE = 1 << 20;
+
+    static int[] a = new int[1000];
+
+    static long sumUp(long from, long to) {
+        long s = 0;
+        for (long i = from; i < to; i++) {
+            s += a[(int)(i - from)];
+        }
+        return s;
+    }
+
+    static long sumDown(long from, long to) {
+        long s = 0;
+        for (long i = from; i > to; i -= 3) {
+            s += a[(int)(from - i)] * i;
+        }
+        return s;
+    }
+
+    static long sumInclusive(long from, long to) {
+        long s = 0;
+        for (long i = from; i <= to; i += 2) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    static long wideUp(long from) {
+        long s = 0;
+        for (long i = from; i < from + 3L * Integer.MAX_VALUE; i += WIDE_STRIDE) {
+            s += i;
+        }
+        return s;
+    }
+
+    static long wideUpInclusive(long from) {
+        long s = 0;
+        for (long i = from; i <= from + 3L * Integer.MAX_VALUE; i += WIDE_STRIDE) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    static long wideDown(long from) {
+        long s = 0;
+        for (long i = from; i > from - 3L * Integer.MAX_VALUE; i -= WIDE_STRIDE) {
+            s += i;
+        }
+        return s;
+    }
+
+    static long wideDownInclusive(long from) {
+        long s = 0;
+        for (long i = from; i >= from - 3L * Integer.MAX_VALUE; i -= WIDE_STRIDE) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    // Reference versions, never compiled (see CompileCommand above).
+    static long refSumUp(long from, long to) {
+        long s = 0;
+        for (long i = from; i < to; i++) {
+            s += a[(int)(i - from)];
+        }
+        return s;
+    }
+
+    static long refSumDown(long from, long to) {
+        long s = 0;
+        for (long i = from; i > to; i -= 3) {
+            s += a[(int)(from - i)] * i;
+        }
+        return s;
+    }
+
+    static long refSumInclusive(long from, long to) {
+        long s = 0;
+        for (long i = from; i <= to; i += 2) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    static long refWideUp(long from) {
+        long s = 0;
+        for (long i = from; i < from + 3L * Integer.MAX_VALUE; i += WIDE_STRIDE) {
+            s += i;
+        }
+        return s;
+    }
+
+    static long refWideUpInclusive(long from) {
+        long s = 0;
+        for (long i = from; i <= from + 3L * Integer.MAX_VALUE; i += WIDE_STRIDE) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    static long refWideDown(long from) {
+        long s = 0;
+        for (long i = from; i > from - 3L * Integer.MAX_VALUE; i -= WIDE_STRIDE) {
+            s += i;
+        }
+        return s;
+    }
+
+    static long refWideDownInclusive(long from) {
+        long s = 0;
+        for (long i = from; i >= from - 3L * Integer.MAX_VALUE; i -= WIDE_STRIDE) {
+            s ^= i;
+        }
+        return s;
+    }
+
+    static void check(String name, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    // The runs above also pass if the loops are left alone. Check in a
+    // debug VM that the constant stride loops are strip mined.
+    static void verifyTrace() throws Exception {
+        TraceCheck.verify("StripMineLong", TestLongLoopStripMining.class,
+                          "-Xbatch", "-XX:-TieredCompilation",
+                          "-XX:CompileCommand=compileonly,compiler.loopopts.TestLongLoopStripMining::wide*",
+                          "-XX:+TraceLoopOpts");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyTrace();
+            return;
+        }
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i * 7 + 1;
+        }
+        long[] starts = { 0, 5, Integer.MAX_VALUE - 10, -Integer.MAX_VALUE - 500, Long.MAX_VALUE - 2000, Long.MIN_VALUE + 2000 };
+        for (int iter = 0; iter < ITERS; iter++) {
+            long from = starts[iter % starts.length];
+            int len = iter % a.length;
+            check("sumUp", refSumUp(from, from + len), sumUp(from, from + len));
+            check("sumUp empty", refSumUp(from, from - len), sumUp(from, from - len));
+            check("sumDown", refSumDown(from + len, from), sumDown(from + len, from));
+            check("sumInclusive", refSumInclusive(from, from + len), sumInclusive(from, from + len));
+        }
+        // Every start keeps the limits in range so the loops do not wrap.
+        long[] wideStarts = { 0, -5L * Integer.MAX_VALUE, 12345, Long.MAX_VALUE - 4L * Integer.MAX_VALUE };
+        for (int iter = 0; iter < WIDE_ITERS; iter++) {
+            long from = wideStarts[iter % wideStarts.length];
+            check("wideUp", refWideUp(from), wideUp(from));
+            check("wideUpInclusive", refWideUpInclusive(from), wideUpInclusive(from));
+            check("wideDown", refWideDown(-from), wideDown(-from));
+            check("wideDownInclusive", refWideDownInclusive(-from), wideDownInclusive(-from));
+        }
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary SuperWord vectorization of sum, product, min, max, and, or and xor reductions
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestReductions::ref*
+ *      compiler.loopopts.superword.TestReductions
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestReductions::ref*
+ *      -XX:-SuperWordReductions compiler.loopopts.superword.TestReductions
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestReductions::ref*
+ *      -XX:LoopUnrollLimit=250 compiler.loopopts.superword.TestReductions
+ * @run main compiler.loopopts.superword.TestReductions trace
+ */
+
+package compiler.loopopts.superword;
+
+import com.oracle.java.testlibrary.Platform;
+import opto.TraceCheck;
+
+public class TestReductions {
+    static final int ITERS = 6000;
+
+    static int[] ia;
+    static long[] la;
+    static float[] fa;
+    static double[] da;
+
+    static int sumI(int[] a)  { int r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static int mulI(int[] a)  { int r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static int minI(int[] a)  { int r = Integer.MAX_VALUE; for (int i = 0; i < a.length; i++) { r = Math.min(r, a[i]); } return r; }
+    static int maxI(int[] a)  { int r = Integer.MIN_VALUE; for (int i = 0; i < a.length; i++) { r = Math.max(r, a[i]); } return r; }
+    static int andI(int[] a)  { int r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static int orI(int[] a)   { int r = 0; for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static int xorI(int[] a)  { int r = 0; for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+    static long sumL(long[] a) { long r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static long andL(long[] a) { long r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static long orL(long[] a)  { long r = 0; for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static long xorL(long[] a) { long r = 0; for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+    static float sumF(float[] a)    { float r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static float mulF(float[] a)    { float r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static double sumD(double[] a)  { double r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static double mulD(double[] a)  { double r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+
+    // Reference versions, never compiled (see CompileCommand above).
+    static int refSumI(int[] a)  { int r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static int refMulI(int[] a)  { int r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static int refMinI(int[] a)  { int r = Integer.MAX_VALUE; for (int i = 0; i < a.length; i++) { r = Math.min(r, a[i]); } return r; }
+    static int refMaxI(int[] a)  { int r = Integer.MIN_VALUE; for (int i = 0; i < a.length; i++) { r = Math.max(r, a[i]); } return r; }
+    static int refAndI(int[] a)  { int r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static int refOrI(int[] a)   { int r = 0; for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static int refXorI(int[] a)  { int r = 0; for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+    static long refSumL(long[] a) { long r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static long refAndL(long[] a) { long r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static long refOrL(long[] a)  { long r = 0; for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static long refXorL(long[] a) { long r = 0; for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+    static float refSumF(float[] a)    { float r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static float refMulF(float[] a)    { float r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static double refSumD(double[] a)  { double r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static double refMulD(double[] a)  { double r = 1; for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+
+    static void check(String name, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    static void check(String name, double expected, double actual) {
+        // Floating point reductions must keep the sequential order,
+        // so the results have to be bit-identical.
+        if (Double.doubleToRawLongBits(expected) != Double.doubleToRawLongBits(actual)) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    static void init(int len) {
+        ia = new int[len];
+        la = new long[len];
+        fa = new float[len];
+        da = new double[len];
+        for (int i = 0; i < len; i++) {
+            ia[i] = (i * 0x9E3779B1) ^ (i >>> 3);
+            la[i] = ((long)ia[i] << 21) ^ i;
+            // Values of very different magnitude expose any reordering.
+            fa[i] = (i % 3 == 0) ? 1.0e7f + i : 1.0f / (i + 1);
+            da[i] = (i % 3 == 0) ? 1.0e17 + i : 1.0 / (i + 1);
+        }
+        // Keep products from overflowing to zero or infinity.
+        for (int i = 0; i < len; i++) {
+            ia[i] |= 1;
+        }
+    }
+
+    static void verify() {
+        float[] mf = new float[fa.length];
+        double[] md = new double[da.length];
+        for (int i = 0; i < mf.length; i++) {
+            mf[i] = 1.0f + (i % 7) * 0.001f;
+            md[i] = 1.0 + (i % 7) * 0.0001;
+        }
+        check("sumI", refSumI(ia), sumI(ia));
+        check("mulI", refMulI(ia), mulI(ia));
+        check("minI", refMinI(ia), minI(ia));
+        check("maxI", refMaxI(ia), maxI(ia));
+        check("andI", refAndI(ia), andI(ia));
+        check("orI",  refOrI(ia),  orI(ia));
+        check("xorI", refXorI(ia), xorI(ia));
+        check("sumL", refSumL(la), sumL(la));
+        check("andL", refAndL(la), andL(la));
+        check("orL",  refOrL(la),  orL(la));
+        check("xorL", refXorL(la), xorL(la));
+        check("sumF", refSumF(fa), sumF(fa));
+        check("mulF", refMulF(mf), mulF(mf));
+        check("sumD", refSumD(da), sumD(da));
+        check("mulD", refMulD(md), mulD(md));
+    }
+
+    // The runs above also pass if the loops stay scalar. Check in a debug
+    // VM that the int sum is compiled to a vector reduction.
+    static void verifyTrace() throws Exception {
+        if (!Platform.isX86() && !Platform.isX64()) {
+            return;
+        }
+        TraceCheck.verify("AddReductionVI", TestReductions.class,
+                          "-Xbatch", "-XX:-TieredCompilation",
+                          "-XX:CompileCommand=compileonly,compiler.loopopts.superword.TestReductions::sumI",
+                          "-XX:+PrintIdeal");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyTrace();
+            return;
+        }
+        // Odd and short lengths exercise the pre- and post-loops and the
+        // trip count check; the long one runs mostly in the vector loop.
+        int[] lengths = { 1, 3, 7, 17, 100, 1023 };
+        for (int iter = 0; iter < ITERS; iter++) {
+            init(lengths[iter % lengths.length]);
+            verify();
+        }
+        init(4096);
+        verify();
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Vectorized post-loops drain the iterations left by the unrolled main loop
+ * @library /testlibrary /compiler/testlibrary
+ * @build com.oracle.java.testlibrary.* opto.TraceCheck
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestVectorPostLoop::ref*
+ *      compiler.loopopts.superword.TestVectorPostLoop
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestVectorPostLoop::ref*
+ *      -XX:-VectorizedPostLoop compiler.loopopts.superword.TestVectorPostLoop
+ * @run main/othervm -Xbatch -XX:CompileCommand=exclude,compiler.loopopts.superword.TestVectorPostLoop::ref*
+ *      -XX:LoopUnrollLimit=250 compiler.loopopts.superword.TestVectorPostLoop
+ * @run main compiler.loopopts.superword.TestVectorPostLoop trace
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Arrays;
+
+import com.oracle.java.testlibrary.Platform;
+import opto.TraceCheck;
+
+public class TestVectorPostLoop {
+    static final int ITERS = 300;
+    static final int MAX_LEN = 100;
+
+    static void copyB(byte[] a, byte[] b)       { for (int i = 0; i < a.length; i++) { b[i] = a[i]; } }
+    static void addI(int[] a, int[] b, int[] c) { for (int i = 0; i < a.length; i++) { c[i] = a[i] + b[i]; } }
+    static void mulL(long[] a, long[] b)        { for (int i = 0; i < a.length; i++) { b[i] = a[i] * 3; } }
+    static void addF(float[] a, float[] b)      { for (int i = 0; i < a.length; i++) { b[i] = a[i] + 1.5f; } }
+    static void mulD(double[] a, double[] b)    { for (int i = 0; i < a.length; i++) { b[i] = a[i] * 0.5; } }
+    static int sumI(int[] a)                    { int r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+
+    // Reference versions, never compiled (see CompileCommand above).
+    static void refCopyB(byte[] a, byte[] b)       { for (int i = 0; i < a.length; i++) { b[i] = a[i]; } }
+    static void refAddI(int[] a, int[] b, int[] c) { for (int i = 0; i < a.length; i++) { c[i] = a[i] + b[i]; } }
+    static void refMulL(long[] a, long[] b)        { for (int i = 0; i < a.length; i++) { b[i] = a[i] * 3; } }
+    static void refAddF(float[] a, float[] b)      { for (int i = 0; i < a.length; i++) { b[i] = a[i] + 1.5f; } }
+    static void refMulD(double[] a, double[] b)    { for (int i = 0; i < a.length; i++) { b[i] = a[i] * 0.5; } }
+    static int refSumI(int[] a)                    { int r = 0; for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+
+    static void check(String name, int len, boolean ok) {
+        if (!ok) {
+            throw new RuntimeException(name + " failed for length " + len);
+        }
+    }
+
+    static void test(int len) {
+        byte[] ba = new byte[len];
+        int[] ia = new int[len];
+        int[] ib = new int[len];
+        long[] la = new long[len];
+        float[] fa = new float[len];
+        double[] da = new double[len];
+        for (int i = 0; i < len; i++) {
+            ba[i] = (byte)(i * 7);
+            ia[i] = i * 0x9E3779B1;
+            ib[i] = ~i;
+            la[i] = ((long)ia[i] << 17) ^ i;
+            fa[i] = i / 3.0f;
+            da[i] = i / 7.0;
+        }
+
+        byte[] b1 = new byte[len];
+        byte[] b2 = new byte[len];
+        copyB(ba, b1);
+        refCopyB(ba, b2);
+        check("copyB", len, Arrays.equals(b1, b2));
+
+        int[] i1 = new int[len];
+        int[] i2 = new int[len];
+        addI(ia, ib, i1);
+        refAddI(ia, ib, i2);
+        check("addI", len, Arrays.equals(i1, i2));
+
+        long[] l1 = new long[len];
+        long[] l2 = new long[len];
+        mulL(la, l1);
+        refMulL(la, l2);
+        check("mulL", len, Arrays.equals(l1, l2));
+
+        float[] f1 = new float[len];
+        float[] f2 = new float[len];
+        addF(fa, f1);
+        refAddF(fa, f2);
+        check("addF", len, Arrays.equals(f1, f2));
+
+        double[] d1 = new double[len];
+        double[] d2 = new double[len];
+        mulD(da, d1);
+        refMulD(da, d2);
+        check("mulD", len, Arrays.equals(d1, d2));
+
+        check("sumI", len, sumI(ia) == refSumI(ia));
+    }
+
+    // The runs above also pass with only scalar post-loops. Check in a
+    // debug VM that the int add loop gets a vectorized post-loop.
+    static void verifyTrace() throws Exception {
+        if (!Platform.isX86() && !Platform.isX64()) {
+            return;
+        }
+        TraceCheck.verify("VectorPost", TestVectorPostLoop.class,
+                          "-Xbatch", "-XX:-TieredCompilation",
+                          "-XX:CompileCommand=compileonly,compiler.loopopts.superword.TestVectorPostLoop::addI",
+                          "-XX:+TraceLoopOpts");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("trace")) {
+            verifyTrace();
+            return;
+        }
+        // Every length up to MAX_LEN leaves a different number of
+        // iterations for the vector and the scalar post-loops.
+        for (int iter = 0; iter < ITERS; iter++) {
+            for (int len = 0; len <= MAX_LEN; len++) {
+                test(len);
+            }
+        }
+        test(4099);
+    }
+}
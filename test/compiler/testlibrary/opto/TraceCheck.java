@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package opto;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.Platform;
+import com.oracle.java.testlibrary.ProcessTools;
+
+/**
+ * Checks that a C2 transformation or intrinsic actually fired, rather than
+ * only that the compiled code computed the right result.
+ */
+public class TraceCheck {
+    /**
+     * Runs {@code mainClass} in a new JVM with {@code options} and verifies
+     * that its output matches {@code pattern}. The trace flags C2 prints
+     * its transformations under are develop or notproduct flags, so the
+     * check is skipped on product builds.
+     *
+     * @param pattern regular expression the trace output has to match
+     * @param mainClass class to run in the new JVM, with no arguments
+     * @param options VM options, including the trace flag to use
+     */
+    public static void verify(String pattern, Class<?> mainClass, String... options) throws Exception {
+        if (!Platform.isDebugBuild()) {
+            System.out.println("Trace flags require a debug build. Skipping the trace check.");
+            return;
+        }
+        ArrayList<String> args = new ArrayList<>();
+        Collections.addAll(args, options);
+        run(mainClass, args).shouldMatch(pattern);
+    }
+
+    /**
+     * Runs {@code mainClass} in a new JVM with {@code options} and the
+     * diagnostic PrintIntrinsics flag, which product builds have too. If
+     * the boolean flag {@code useFlag} ends up enabled on this machine,
+     * verifies that C2 reported an intrinsic matching {@code pattern}.
+     *
+     * @param useFlag flag that enables the intrinsic when the CPU supports it
+     * @param pattern regular expression the PrintIntrinsics output has to match
+     * @param mainClass class to run in the new JVM, with no arguments
+     * @param options additional VM options
+     */
+    public static void verifyIntrinsic(String useFlag, String pattern, Class<?> mainClass, String... options) throws Exception {
+        ArrayList<String> args = new ArrayList<>();
+        Collections.addAll(args, "-Xbatch", "-XX:-TieredCompilation", "-XX:+UnlockDiagnosticVMOptions",
+                           "-XX:+PrintIntrinsics", "-XX:+PrintFlagsFinal");
+        Collections.addAll(args, options);
+        OutputAnalyzer output = run(mainClass, args);
+        Pattern enabled = Pattern.compile("\\bbool\\s+" + useFlag + "\\s+:?=\\s*true\\b");
+        if (!enabled.matcher(output.getStdout()).find()) {
+            System.out.println(useFlag + " is off on this machine. Skipping the intrinsic check.");
+            return;
+        }
+        output.shouldMatch(pattern);
+    }
+
+    private static OutputAnalyzer run(Class<?> mainClass, ArrayList<String> args) throws Exception {
+        args.add(mainClass.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args.toArray(new String[args.size()]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+}
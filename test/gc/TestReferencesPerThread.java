@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestReferencesPerThread
+ * @key gc
+ * @summary Process discovered references with an ergonomically chosen number of workers
+ * @run main/othervm -XX:+UseParallelGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=100 TestReferencesPerThread
+ * @run main/othervm -XX:+UseParallelGC -XX:-UseParallelOldGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=100 TestReferencesPerThread
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=100 TestReferencesPerThread
+ * @run main/othervm -XX:+UseG1GC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=100 TestReferencesPerThread
+ * @run main/othervm -XX:+UseG1GC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=0 TestReferencesPerThread
+ * @run main/othervm -XX:+UseParallelGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=1000000 TestReferencesPerThread
+ * @run main/othervm -XX:+UseParNewGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=1000000 -Xmn8m TestReferencesPerThread
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:+ParallelRefProcEnabled -XX:ParallelGCThreads=4 -XX:ReferencesPerThread=100 -Xmn8m TestReferencesPerThread
+ */
+
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestReferencesPerThread {
+  public static void main(String args[]) throws Exception {
+    List<Object> strong = new ArrayList<Object>();
+    List<WeakReference<Object>> refs = new ArrayList<WeakReference<Object>>();
+    for (int i = 0; i < 50000; i++) {
+      Object o = new Object();
+      if (i % 2 == 0) {
+        strong.add(o);
+      }
+      refs.add(new WeakReference<Object>(o));
+    }
+    System.gc();
+    for (int i = 0; i < refs.size(); i += 2) {
+      if (refs.get(i).get() != strong.get(i / 2)) {
+        throw new RuntimeException("Strongly reachable referent " + i + " was cleared");
+      }
+    }
+
+    // Young collections which only discover a handful of references, so
+    // that a single worker processes them.
+    Object[] live = new Object[8];
+    for (int i = 0; i < 2000000; i++) {
+      Object o = new Object[4];
+      if (i % 250000 == 0) {
+        live[i / 250000] = o;
+        refs.add(new WeakReference<Object>(o));
+      }
+    }
+    for (int i = 0; i < live.length; i++) {
+      if (refs.get(50000 + i).get() != live[i]) {
+        throw new RuntimeException("Strongly reachable referent " + (50000 + i) + " was cleared");
+      }
+    }
+  }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestCMSStripedRescan
+ * @key gc
+ * @summary Run CMS cycles with the parallel remark rescanning dirty cards from per-worker stripes
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:+CMSStripedRescan -XX:ParallelGCThreads=4 -XX:CMSRescanMultiple=1 -XX:+ExplicitGCInvokesConcurrent -Xmn8m -Xmx64m TestCMSStripedRescan
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:-CMSStripedRescan -XX:ParallelGCThreads=4 -XX:+ExplicitGCInvokesConcurrent -Xmn8m -Xmx64m TestCMSStripedRescan
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:+CMSStripedRescan -XX:ParallelGCThreads=1 -XX:+ExplicitGCInvokesConcurrent -Xmn8m -Xmx64m TestCMSStripedRescan
+ * @run main/othervm -XX:+UseConcMarkSweepGC -XX:+CMSStripedRescan -XX:ParallelGCThreads=4 -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC -Xmn8m -Xmx64m TestCMSStripedRescan
+ */
+
+public class TestCMSStripedRescan {
+  static Object[][] old = new Object[256][];
+
+  public static void main(String args[]) throws Exception {
+    for (int i = 0; i < old.length; i++) {
+      old[i] = new Object[1024];
+    }
+    System.gc();
+    // Keep dirtying cards across the old generation while cycles run
+    for (int round = 0; round < 20; round++) {
+      for (int i = 0; i < 200000; i++) {
+        Object[] a = old[(i * 31) % old.length];
+        a[i % a.length] = new int[4];
+      }
+      System.gc();
+    }
+    for (Object[] a : old) {
+      for (Object o : a) {
+        if (o != null && ((int[]) o).length != 4) {
+          throw new RuntimeException("Corrupted element");
+        }
+      }
+    }
+  }
+}
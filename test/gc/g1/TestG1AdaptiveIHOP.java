@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestG1AdaptiveIHOP
+ * @key gc
+ * @summary G1: the adaptive IHOP is updated from young-only pauses and starts concurrent cycles
+ * @library /testlibrary
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestG1AdaptiveIHOP {
+    private static final int heapSize       = 128; // MB
+    private static final int heapRegionSize = 1;   // MB
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xms" + heapSize + "m",
+            "-Xmx" + heapSize + "m",
+            "-Xmn8m",
+            "-XX:G1HeapRegionSize=" + heapRegionSize + "m",
+            "-XX:+G1UseAdaptiveIHOP",
+            "-XX:+PrintGC",
+            "-XX:+PrintAdaptiveSizePolicy",
+            OldGenAllocator.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("update IHOP");
+        output.shouldContain("update adaptive IHOP");
+        output.shouldContain("(initial-mark)");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class OldGenAllocator {
+        public static void main(String [] args) throws Exception {
+            // Keep a sliding window of live objects so that they are
+            // promoted and the old gen fills up repeatedly.
+            List<byte[]> live = new ArrayList<byte[]>();
+            for (int i = 0; i < 200000; i++) {
+                live.add(new byte[1024]);
+                if (live.size() > 40000) {
+                    live.subList(0, 20000).clear();
+                }
+            }
+        }
+    }
+}
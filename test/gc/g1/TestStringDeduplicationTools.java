@@ -365,6 +365,22 @@ class TestStringDeduplicationTools {
         output.shouldHaveExitValue(0);
     }
 
+    public static void testThreads() throws Exception {
+        // Test with several deduplication threads sharing the table while it is resized
+        OutputAnalyzer output = DeduplicationTest.run(LargeNumberOfStrings,
+                                                      DefaultAgeThreshold,
+                                                      YoungGC,
+                                                      "-XX:+PrintGC",
+                                                      "-XX:+PrintStringDeduplicationStatistics",
+                                                      "-XX:ParallelGCThreads=4",
+                                                      "-XX:StringDeduplicationThreads=4",
+                                                      "-XX:+StringDeduplicationResizeALot");
+        output.shouldContain("GC concurrent-string-deduplication");
+        output.shouldContain("Deduplicated:");
+        output.shouldNotContain("Resize Count: 0");
+        output.shouldHaveExitValue(0);
+    }
+
     public static void testAgeThreshold() throws Exception {
         OutputAnalyzer output;
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestAsyncGCLogging
+ * @summary GC and safepoint logging written by the async log writer must reach stdout and the -Xloggc file
+ * @key gc
+ * @library /testlibrary
+ */
+
+import com.oracle.java.testlibrary.ProcessTools;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+
+import java.io.File;
+import java.nio.file.Files;
+
+public class TestAsyncGCLogging {
+  public static void main(String[] args) throws Exception {
+    ProcessBuilder pb =
+      ProcessTools.createJavaProcessBuilder("-XX:+AsyncGCLogging", "-XX:+PrintGCDetails",
+                                            "-XX:+PrintSafepointStatistics",
+                                            "-XX:PrintSafepointStatisticsCount=1",
+                                            "-Xmx16M", GCTest.class.getName());
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldContain("[Full GC");
+    output.shouldContain("page_trap_count");
+    output.shouldHaveExitValue(0);
+
+    // A buffer this small drops messages rather than blocking
+    pb = ProcessTools.createJavaProcessBuilder("-XX:+AsyncGCLogging", "-XX:AsyncLogBufferSize=8K",
+                                               "-XX:+PrintGCDetails", "-Xmx16M", GCTest.class.getName());
+    output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+
+    File log = new File("async_gc.log");
+    pb = ProcessTools.createJavaProcessBuilder("-XX:+AsyncGCLogging", "-Xloggc:" + log.getName(),
+                                               "-XX:+PrintGCDetails", "-Xmx16M", GCTest.class.getName());
+    output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+    String contents = new String(Files.readAllBytes(log.toPath()));
+    if (!contents.contains("[Full GC")) {
+      throw new RuntimeException("GC log does not contain the full collections:\n" + contents);
+    }
+  }
+
+  static class GCTest {
+    private static byte[] garbage;
+    public static void main(String [] args) {
+      for (int i = 0; i < 10; i++) {
+        garbage = new byte[1024 * 1024];
+        System.gc();
+      }
+    }
+  }
+}
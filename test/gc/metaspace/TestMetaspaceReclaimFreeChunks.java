@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestMetaspaceReclaimFreeChunks
+ * @key gc
+ * @summary Committed Metaspace goes down after the class loaders using it are unloaded
+ * @run main/othervm -XX:+MetaspaceReclaimFreeChunks -XX:+UseSerialGC TestMetaspaceReclaimFreeChunks
+ * @run main/othervm -XX:+MetaspaceReclaimFreeChunks -XX:+UseParallelGC TestMetaspaceReclaimFreeChunks
+ * @run main/othervm -XX:+MetaspaceReclaimFreeChunks -XX:+UseG1GC TestMetaspaceReclaimFreeChunks
+ * @run main/othervm -XX:-MetaspaceReclaimFreeChunks -XX:+UseSerialGC TestMetaspaceReclaimFreeChunks
+ */
+
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestMetaspaceReclaimFreeChunks {
+  public static class Loaded {
+  }
+
+  static class OneClassLoader extends ClassLoader {
+    private final byte[] bytes;
+
+    OneClassLoader(byte[] bytes) {
+      super(null);
+      this.bytes = bytes;
+    }
+
+    protected Class<?> findClass(String name) throws ClassNotFoundException {
+      if (!name.equals(Loaded.class.getName())) {
+        throw new ClassNotFoundException(name);
+      }
+      return defineClass(name, bytes, 0, bytes.length);
+    }
+  }
+
+  private static byte[] loadedBytes() throws Exception {
+    String resource = Loaded.class.getName().replace('.', '/') + ".class";
+    InputStream in = TestMetaspaceReclaimFreeChunks.class.getClassLoader().getResourceAsStream(resource);
+    ByteArrayOutputStream out = new ByteArrayOutputStream();
+    byte[] buf = new byte[4096];
+    int n;
+    while ((n = in.read(buf)) > 0) {
+      out.write(buf, 0, n);
+    }
+    in.close();
+    return out.toByteArray();
+  }
+
+  private static long committedMetaspace() {
+    for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+      if (pool.getName().equals("Metaspace")) {
+        return pool.getUsage().getCommitted();
+      }
+    }
+    throw new RuntimeException("No Metaspace memory pool");
+  }
+
+  private static List<Class<?>> loadClasses(byte[] bytes, int count) throws Exception {
+    List<Class<?>> classes = new ArrayList<Class<?>>();
+    for (int i = 0; i < count; i++) {
+      classes.add(new OneClassLoader(bytes).loadClass(Loaded.class.getName()));
+    }
+    return classes;
+  }
+
+  public static void main(String args[]) throws Exception {
+    byte[] bytes = loadedBytes();
+
+    for (int round = 0; round < 3; round++) {
+      List<Class<?>> classes = loadClasses(bytes, 5000);
+      long peak = committedMetaspace();
+      classes = null;
+      System.gc();
+      long after = committedMetaspace();
+      System.out.println("Round " + round + ": committed " + peak + " -> " + after);
+      if (after > peak) {
+        throw new RuntimeException("Committed Metaspace grew from " + peak + " to " + after +
+                                   " after unloading the class loaders");
+      }
+    }
+  }
+}
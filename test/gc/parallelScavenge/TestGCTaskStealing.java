@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestGCTaskStealing
+ * @key gc
+ * @summary Run young and full ParallelGC collections with GC tasks handed out by work stealing
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseGCTaskStealing -XX:ParallelGCThreads=4 -Xmn8m TestGCTaskStealing
+ * @run main/othervm -XX:+UseParallelGC -XX:-UseParallelOldGC -XX:+UseGCTaskStealing -XX:ParallelGCThreads=4 -Xmn8m TestGCTaskStealing
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseGCTaskStealing -XX:+UseGCTaskAffinity -XX:ParallelGCThreads=4 -Xmn8m TestGCTaskStealing
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseGCTaskStealing -XX:+UseDynamicNumberOfGCThreads -XX:ParallelGCThreads=8 -Xmn8m TestGCTaskStealing
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseGCTaskStealing -XX:ParallelGCThreads=1 -Xmn8m TestGCTaskStealing
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestGCTaskStealing {
+  public static void main(String args[]) throws Exception {
+    List<Object[]> live = new ArrayList<Object[]>();
+    for (int i = 0; i < 200000; i++) {
+      Object[] garbage = new Object[16];
+      if (i % 100 == 0) {
+        live.add(garbage);
+      }
+    }
+    System.gc();
+    for (Object[] o : live) {
+      if (o.length != 16) {
+        throw new RuntimeException("Unexpected array length " + o.length);
+      }
+    }
+  }
+}
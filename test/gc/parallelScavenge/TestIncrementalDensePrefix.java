@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestIncrementalDensePrefix
+ * @key gc
+ * @summary Run ParallelOld full GCs that compact only the sparse upper part of the old generation
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseParallelOldGC -XX:+ParallelOldIncrementalCompaction -Xmn4m -Xmx64m TestIncrementalDensePrefix
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseParallelOldGC -XX:+ParallelOldIncrementalCompaction -XX:ParallelOldIncrementalReclaimPercent=1 -Xmn4m -Xmx64m TestIncrementalDensePrefix
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseParallelOldGC -XX:+ParallelOldIncrementalCompaction -XX:ParallelOldIncrementalReclaimPercent=100 -XX:HeapMaximumCompactionInterval=1000 -Xmn4m -Xmx64m TestIncrementalDensePrefix
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestIncrementalDensePrefix {
+  public static void main(String args[]) throws Exception {
+    // A stable, dense bottom of the old generation
+    List<int[]> stable = new ArrayList<int[]>();
+    for (int i = 0; i < 2000; i++) {
+      stable.add(new int[1024]);
+    }
+    System.gc();
+
+    // Churn that leaves sparse regions above it
+    List<int[]> churn = new ArrayList<int[]>();
+    for (int round = 0; round < 30; round++) {
+      for (int i = 0; i < 1000; i++) {
+        int[] a = new int[256];
+        a[0] = i;
+        churn.add(a);
+      }
+      for (int i = churn.size() - 1; i >= 0; i -= 2) {
+        churn.remove(i);
+      }
+      System.gc();
+    }
+
+    for (int[] a : stable) {
+      if (a.length != 1024) {
+        throw new RuntimeException("Unexpected array length " + a.length);
+      }
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test HandshakeTest
+ * @summary Sample stack traces and revoke biases of single threads through thread-local handshakes
+ * @run main/othervm -XX:+ThreadLocalHandshakes -XX:+UseBiasedLocking -XX:BiasedLockingStartupDelay=0 HandshakeTest
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+ThreadLocalHandshakes -XX:HandshakeTimeout=0 -XX:+UseBiasedLocking -XX:BiasedLockingStartupDelay=0 HandshakeTest
+ * @run main/othervm -XX:-ThreadLocalHandshakes -XX:+UseBiasedLocking -XX:BiasedLockingStartupDelay=0 HandshakeTest
+ */
+
+public class HandshakeTest {
+    static volatile boolean done;
+    static final Object[] locks = new Object[1000];
+    static int acquired;
+
+    static class Worker extends Thread {
+        long sum;
+
+        public void run() {
+            int i = 0;
+            while (!done) {
+                synchronized (locks[i++ % locks.length]) {
+                    sum += i;
+                }
+                if ((i & 0xfff) == 0) {
+                    Thread.yield();
+                }
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < locks.length; i++) {
+            locks[i] = new Object();
+        }
+        Worker worker = new Worker();
+        worker.start();
+
+        long deadline = System.currentTimeMillis() + 3000;
+        int i = 0;
+        while (System.currentTimeMillis() < deadline) {
+            StackTraceElement[] trace = worker.getStackTrace();
+            for (StackTraceElement e : trace) {
+                if (e.getClassName() == null) {
+                    throw new RuntimeException("Incomplete stack trace");
+                }
+            }
+            // Lock objects biased toward the worker from this thread.
+            synchronized (locks[i++ % locks.length]) {
+                acquired++;
+            }
+        }
+
+        done = true;
+        worker.join();
+        if (worker.getStackTrace().length != 0) {
+            throw new RuntimeException("Terminated thread should not have a stack trace");
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test AsyncDeflateIdleMonitorsTest
+ * @summary Inflate, hash and deflate many monitors with deflation running on the service thread
+ * @run main/othervm -XX:+AsyncDeflateIdleMonitors -XX:AsyncDeflationInterval=1 AsyncDeflateIdleMonitorsTest
+ * @run main/othervm -XX:+AsyncDeflateIdleMonitors -XX:AsyncDeflationInterval=1 -XX:MonitorBound=100 AsyncDeflateIdleMonitorsTest
+ * @run main/othervm -XX:+AsyncDeflateIdleMonitors -XX:-UseBiasedLocking AsyncDeflateIdleMonitorsTest
+ */
+
+public class AsyncDeflateIdleMonitorsTest {
+  static final int N_OBJECTS = 1024;
+  static final int N_THREADS = 4;
+  static final int N_ITERATIONS = 200;
+
+  static final Object[] objects = new Object[N_OBJECTS];
+  static final int[] hashes = new int[N_OBJECTS];
+  static final int[] counters = new int[N_OBJECTS];
+
+  public static void main(String args[]) throws Exception {
+    for (int i = 0; i < N_OBJECTS; i++) {
+      objects[i] = new Object();
+    }
+
+    Thread[] threads = new Thread[N_THREADS];
+    for (int t = 0; t < N_THREADS; t++) {
+      threads[t] = new Thread() {
+        public void run() {
+          for (int n = 0; n < N_ITERATIONS; n++) {
+            for (int i = 0; i < N_OBJECTS; i++) {
+              Object o = objects[i];
+              synchronized (o) {
+                counters[i]++;
+                if ((n & 7) == 0 && (i & 15) == 0) {
+                  // Force inflation while we hold the lock
+                  try {
+                    o.wait(0, 1);
+                  } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                  }
+                }
+              }
+              int h = System.identityHashCode(o);
+              synchronized (hashes) {
+                if (hashes[i] == 0) {
+                  hashes[i] = h;
+                } else if (hashes[i] != h) {
+                  throw new RuntimeException("Identity hash changed for object " + i +
+                                             ": " + hashes[i] + " != " + h);
+                }
+              }
+            }
+            if ((n % 50) == 0) {
+              Thread.yield();
+            }
+          }
+        }
+      };
+    }
+
+    final Throwable[] failure = new Throwable[1];
+    for (Thread t : threads) {
+      t.setUncaughtExceptionHandler(new Thread.UncaughtExceptionHandler() {
+        public void uncaughtException(Thread th, Throwable e) {
+          failure[0] = e;
+        }
+      });
+      t.start();
+    }
+    for (Thread t : threads) {
+      t.join();
+    }
+    if (failure[0] != null) {
+      throw new RuntimeException("Worker failed", failure[0]);
+    }
+
+    for (int i = 0; i < N_OBJECTS; i++) {
+      if (counters[i] != N_THREADS * N_ITERATIONS) {
+        throw new RuntimeException("Lost update on object " + i + ": " + counters[i]);
+      }
+    }
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestParallelSafepointCleanup
+ * @summary Run safepoint cleanup tasks on the parallel GC workers and report their share of each safepoint
+ * @library /testlibrary
+ * @run main TestParallelSafepointCleanup
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+
+import com.oracle.java.testlibrary.ProcessTools;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+
+public class TestParallelSafepointCleanup {
+    static void test(String... gcFlags) throws Exception {
+        ArrayList<String> flags = new ArrayList<String>(Arrays.asList(gcFlags));
+        flags.add("-XX:ParallelGCThreads=4");
+        flags.add("-XX:+TraceSafepointCleanupTime");
+        flags.add("-XX:+PrintSafepointCleanupShare");
+        flags.add(SystemGCRunner.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(flags.toArray(new String[0]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("\\[deflating idle monitors, [0-9.]+ secs(, worker [0-9]+)?\\]");
+        output.shouldMatch("\\[mark nmethods, [0-9.]+ secs(, worker [0-9]+)?\\]");
+        output.shouldMatch("\\[safepoint: .*, total [0-9.]+ ms, cleanup [0-9.]+ ms \\([0-9.]+%\\)\\]");
+    }
+
+    public static void main(String[] args) throws Exception {
+        test("-XX:+UseG1GC");
+        test("-XX:+UseG1GC", "-XX:-ParallelSafepointCleanup");
+        test("-XX:+UseParNewGC");
+        test("-XX:+UseParallelGC");
+    }
+
+    static class SystemGCRunner {
+        public static void main(String[] args) {
+            System.gc();
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestThreadLocalPolls
+ * @summary Reach safepoints and handshakes through the thread-local polls of interpreted, C1 and C2 code
+ * @run main/othervm -Xint -XX:+ThreadLocalHandshakes TestThreadLocalPolls
+ * @run main/othervm -XX:TieredStopAtLevel=1 -XX:+ThreadLocalHandshakes TestThreadLocalPolls
+ * @run main/othervm -XX:-TieredCompilation -XX:+ThreadLocalHandshakes TestThreadLocalPolls
+ * @run main/othervm -XX:-TieredCompilation -XX:-ThreadLocalHandshakes TestThreadLocalPolls
+ */
+
+public class TestThreadLocalPolls {
+    static volatile boolean done;
+
+    static class Spinner extends Thread {
+        long sum;
+
+        public void run() {
+            long i = 0;
+            while (!done) {
+                sum += loop(i++);
+            }
+        }
+
+        static long loop(long seed) {
+            long r = seed;
+            for (int i = 0; i < 100000; i++) {
+                r = r * 31 + i;
+            }
+            return r;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Spinner[] spinners = new Spinner[4];
+        for (int i = 0; i < spinners.length; i++) {
+            spinners[i] = new Spinner();
+            spinners[i].start();
+        }
+
+        long deadline = System.currentTimeMillis() + 3000;
+        int rounds = 0;
+        while (System.currentTimeMillis() < deadline) {
+            for (Spinner s : spinners) {
+                if (s.getStackTrace() == null) {
+                    throw new RuntimeException("No stack trace for " + s);
+                }
+            }
+            if (++rounds % 10 == 0) {
+                System.gc();
+            }
+        }
+
+        done = true;
+        for (Spinner s : spinners) {
+            s.join();
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test ResizeStringTableTest
+ * @summary Interned strings and symbols stay interned while the tables grow
+ * @library /testlibrary /testlibrary/whitebox
+ * @build ResizeStringTableTest
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI -XX:StringTableSize=1009 -XX:+UnlockExperimentalVMOptions -XX:SymbolTableSize=1009 ResizeStringTableTest
+ */
+
+import sun.hotspot.WhiteBox;
+
+public class ResizeStringTableTest {
+    public static void main(String... args) {
+        WhiteBox wb = WhiteBox.getWhiteBox();
+        String[] strings = new String[100000];
+        for (int i = 0; i < strings.length; i++) {
+            strings[i] = ("resize" + i).intern();
+            if (i % 10000 == 0) {
+                // Each full GC is a safepoint where the table can grow.
+                wb.fullGC();
+            }
+        }
+        wb.fullGC();
+        for (int i = 0; i < strings.length; i++) {
+            String str = new String("resize" + i);
+            if (!wb.isInStringTable(str)) {
+                throw new RuntimeException("String " + str + " is not interned");
+            }
+            if (str.intern() != strings[i]) {
+                throw new RuntimeException("String " + str + " was interned twice");
+            }
+        }
+    }
+}
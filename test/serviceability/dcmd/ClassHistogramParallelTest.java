@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Class histograms built on the GC worker threads count every instance
+ * @build ClassHistogramParallelTest DcmdUtil
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=4 -XX:+ParallelHeapInspection ClassHistogramParallelTest
+ * @run main/othervm -XX:+UseParallelGC -XX:ParallelGCThreads=4 -XX:+ParallelHeapInspection ClassHistogramParallelTest
+ * @run main/othervm -XX:+UseParallelGC -XX:ParallelGCThreads=4 -XX:-ParallelHeapInspection ClassHistogramParallelTest
+ * @run main/othervm -XX:+UseSerialGC ClassHistogramParallelTest
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+public class ClassHistogramParallelTest {
+    private static final int INSTANCES = 100000;
+
+    //  num     #instances         #bytes  class name
+    // ----------------------------------------------
+    //    1:        100000        1600000  ClassHistogramParallelTest$Counted
+    static Pattern countedLine = Pattern.compile("\\s*\\d+:\\s*(\\d+)\\s*\\d+\\s*ClassHistogramParallelTest\\$Counted");
+
+    static class Counted {
+        long value;
+    }
+
+    public static Counted[] live;
+
+    public static void main(String args[]) throws Exception {
+        live = new Counted[INSTANCES];
+        for (int i = 0; i < INSTANCES; i++) {
+            live[i] = new Counted();
+        }
+
+        String result = DcmdUtil.executeDcmd("GC.class_histogram");
+        Matcher m = countedLine.matcher(result);
+        if (!m.find()) {
+            throw new RuntimeException("Counted class missing from histogram");
+        }
+        long count = Long.parseLong(m.group(1));
+        if (count != INSTANCES) {
+            throw new RuntimeException("Expected " + INSTANCES + " instances, found " + count);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestHeapDumpSegmented
+ * @key gc
+ * @summary Check that parallel and gzip compressed heap dumps are complete
+ * @library /testlibrary
+ * @build com.oracle.java.testlibrary.*
+ * @run main TestHeapDumpSegmented
+ */
+
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.EOFException;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.ArrayList;
+import java.util.zip.GZIPInputStream;
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.ProcessTools;
+
+public class TestHeapDumpSegmented {
+  private static final String HPROF_HEADER_1_0_2 = "JAVA PROFILE 1.0.2";
+  private static final int HPROF_HEAP_DUMP_SEGMENT = 0x1C;
+  private static final int HPROF_HEAP_DUMP_END = 0x2C;
+
+  public static void main(String args[]) throws Exception {
+    String[] gcs = { "-XX:+UseG1GC", "-XX:+UseParallelGC", "-XX:+UseSerialGC" };
+    for (String gc : gcs) {
+      test(gc, "-XX:+HeapDumpParallel", "-XX:HeapDumpGzipLevel=0", false);
+      test(gc, "-XX:-HeapDumpParallel", "-XX:HeapDumpGzipLevel=1", true);
+      test(gc, "-XX:+HeapDumpParallel", "-XX:HeapDumpGzipLevel=6", true);
+    }
+  }
+
+  private static void test(String gc, String parallel, String gzip, boolean compressed) throws Exception {
+    File dump = new File("segmented.hprof");
+    dump.delete();
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+        gc, parallel, gzip, "-Xmx32m", "-XX:ParallelGCThreads=4",
+        "-XX:+HeapDumpOnOutOfMemoryError", "-XX:HeapDumpPath=" + dump.getPath(),
+        Allocate.class.getName());
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldContain("Heap dump file created");
+
+    InputStream in = new BufferedInputStream(new FileInputStream(dump));
+    if (compressed) {
+      in = new GZIPInputStream(in);
+    }
+    try (DataInputStream data = new DataInputStream(in)) {
+      checkDump(data);
+    }
+    File[] parts = new File(".").listFiles((d, name) -> name.startsWith(dump.getName() + ".part"));
+    if (parts.length != 0) {
+      throw new RuntimeException("Part files left behind: " + parts.length);
+    }
+    dump.delete();
+  }
+
+  // Walks the records of the dump and checks that it ends with a
+  // HPROF_HEAP_DUMP_END record.
+  private static void checkDump(DataInputStream in) throws IOException {
+    byte[] header = new byte[HPROF_HEADER_1_0_2.length()];
+    in.readFully(header);
+    if (!new String(header).equals(HPROF_HEADER_1_0_2) || in.readByte() != 0) {
+      throw new RuntimeException("Wrong file header");
+    }
+    in.readInt();  // identifier size
+    in.readLong(); // timestamp
+    int segments = 0;
+    while (true) {
+      int tag = in.readUnsignedByte();
+      in.readInt();
+      long length = in.readInt() & 0xffffffffL;
+      if (tag == HPROF_HEAP_DUMP_END) {
+        break;
+      }
+      if (tag == HPROF_HEAP_DUMP_SEGMENT) {
+        segments++;
+      }
+      while (length > 0) {
+        long skipped = in.skip(length);
+        if (skipped <= 0) {
+          throw new EOFException("Truncated record");
+        }
+        length -= skipped;
+      }
+    }
+    if (segments == 0) {
+      throw new RuntimeException("No heap dump segments");
+    }
+    if (in.read() != -1) {
+      throw new RuntimeException("Data after HPROF_HEAP_DUMP_END");
+    }
+  }
+
+  public static class Allocate {
+    public static void main(String args[]) {
+      ArrayList<Object[]> list = new ArrayList<Object[]>();
+      while (true) {
+        list.add(new Object[1024]);
+      }
+    }
+  }
+}